@@ -0,0 +1,11 @@
+#pragma once
+
+/* Stands in for the parts of the CE toolchain's graphx.h which the renderer
+ * headers use outside of palette mode
+ */
+
+#include <stdint.h>
+
+static inline uint16_t gfx_RGBTo1555(uint8_t r, uint8_t g, uint8_t b) {
+  return ((r >> 3) << 10) | ((g >> 3) << 5) | (b >> 3);
+}
@@ -0,0 +1,296 @@
+/* Renders a scene offline on a desktop machine, with the same fixed point
+ * lighting and shading as the calculator but at any resolution, writing the
+ * result to an image file. This is useful for large reference renders, and
+ * for measuring how rendering time scales with resolution
+ *
+ * Build from the root of the repository with, for example
+ *   g++ -O2 -Ihost -Isrc host/offline.cpp -o offline
+ *
+ * Usage: offline [options]
+ *   -o FILE         Write the image to FILE as a PPM (default render.ppm)
+ *   -hdr FILE       Also write linear colors, after exposure, to FILE as a PFM
+ *   -size W H       Image size in pixels (default 320 240)
+ *   -scene FILE     Scene file written by convertScene.py, raw or .8xv
+ *                   (default built in)
+ *   -vars DIR       Directory holding AppVars such as textures (default .)
+ *   -grain N        Trace one sample per NxN block of pixels (default 1)
+ *   -supersample N  Average NxN samples for each pixel traced (default 1)
+ *   -exposure X     Scale applied to each ray (default 2)
+ *   -preview        Use the preview feature set rather than the final one
+ *
+ * The view matches the calculator's, scaled to the height of the image, so
+ * a 320x240 render with the default options traces the same rays as the
+ * calculator. Directions are computed directly for each sample instead of
+ * being stepped along each row, but they are still fixed point, so above
+ * about 4000 rows neighbouring samples share a direction
+ */
+
+#include <tice.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "scene.h"
+#include "radiosity.h"
+#include "sceneFile.h"
+#include "renderConfig.h"
+#include "shading.h"
+
+// The calculator's view spans LCD_HEIGHT rows of this many units each, and
+// its first row is two rows below the top of the view
+const int64_t view_step = Fixed24(1.0f / LCD_HEIGHT).n;
+const int64_t view_top = LCD_HEIGHT / 2 - 2;
+
+struct Options {
+  const char* output = "render.ppm";
+  const char* hdr = nullptr;
+  const char* scene = nullptr;
+
+  int width = LCD_WIDTH;
+  int height = LCD_HEIGHT;
+  int grain = 1;
+  int supersample = 1;
+  bool preview = false;
+};
+
+/* Computes the direction of a camera ray through the point (x, y) / scale
+ * of an image with the given size, in pixels from its top left corner
+ */
+Vec3 camera_dir(int64_t x, int64_t y, int64_t scale, const Options& options) {
+  int64_t width = options.width * scale;
+  int64_t height = options.height * scale;
+
+  Vec3 dir;
+  dir.x.n = (2 * x - width) * LCD_HEIGHT * view_step / (2 * height);
+  dir.y.n = (view_top * height - LCD_HEIGHT * y) * view_step / height;
+  dir.z = Fixed24(1);
+
+  return dir;
+}
+
+/* Writes 8-bit sRGB colors as a binary PPM
+ */
+bool write_ppm(const char* path, const Color24* pixels, int width, int height) {
+  FILE* file = fopen(path, "wb");
+  if (!file) return false;
+
+  fprintf(file, "P6\n%d %d\n255\n", width, height);
+
+  for (int i = 0; i < width * height; i++) {
+    uint8_t rgb[3] = { pixels[i].r, pixels[i].g, pixels[i].b };
+    fwrite(rgb, 1, 3, file);
+  }
+
+  return fclose(file) == 0;
+}
+
+/* Writes linear colors as a little endian PFM, which stores its rows from
+ * the bottom up
+ */
+bool write_pfm(const char* path, const Spectrum* pixels, int width, int height) {
+  FILE* file = fopen(path, "wb");
+  if (!file) return false;
+
+  fprintf(file, "PF\n%d %d\n-1.0\n", width, height);
+
+  for (int y = height - 1; y >= 0; y--) {
+    for (int x = 0; x < width; x++) {
+      const Spectrum& c = pixels[x + width * y];
+      float rgb[3] = {
+        c.r.n / (float)(1 << POINT),
+        c.g.n / (float)(1 << POINT),
+        c.b.n / (float)(1 << POINT)
+      };
+
+      fwrite(rgb, sizeof(float), 3, file);
+    }
+  }
+
+  return fclose(file) == 0;
+}
+
+/* Traces and averages the samples for the block of pixels with its top left
+ * corner at (x, y)
+ */
+template <class Config>
+Spectrum render_pixel(int x, int y, const Options& options) {
+  const int n = options.supersample;
+
+  Ray ray;
+  ray.origin = cam_origin;
+
+  int64_t sum[3] = { 0, 0, 0 };
+
+  for (int sy = 0; sy < n; sy++) {
+    for (int sx = 0; sx < n; sx++) {
+      ray.dir = camera_dir((int64_t)x * n + sx, (int64_t)y * n + sy, n, options);
+
+      Spectrum sample = compute_ray<Config, false>(ray);
+
+      sum[0] += sample.r.n;
+      sum[1] += sample.g.n;
+      sum[2] += sample.b.n;
+    }
+  }
+
+  Spectrum out;
+  out.r.n = sum[0] / (n * n);
+  out.g.n = sum[1] / (n * n);
+  out.b.n = sum[2] / (n * n);
+
+  return out;
+}
+
+/* Lights the scene and renders it into the image buffers
+ */
+template <class Config>
+void render_image(Spectrum* linear, Color24* pixels, const Options& options) {
+  const int width = options.width;
+  const int height = options.height;
+  const int grain = options.grain;
+
+  compute_illumination();
+  compute_radiosity();
+
+  visibility.compute_all();
+
+  clock_t start = clock();
+
+  for (int y = 0; y < height; y += grain) {
+    for (int x = 0; x < width; x += grain) {
+      Spectrum color = render_pixel<Config>(x, y, options);
+      Color24 color24 = color.toColor24();
+
+      // Fill the block of pixels with this sample
+      for (int py = y; py < y + grain && py < height; py++) {
+        for (int px = x; px < x + grain && px < width; px++) {
+          linear[px + width * py] = color;
+          pixels[px + width * py] = color24;
+        }
+      }
+    }
+  }
+
+  double seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+  long samples = (long)((width + grain - 1) / grain) * ((height + grain - 1) / grain) *
+                 options.supersample * options.supersample;
+
+  fprintf(stderr, "Rendered %dx%d, %ld samples in %.3f s (%.0f samples/s)\n",
+          width, height, samples, seconds, seconds > 0 ? samples / seconds : 0.0);
+}
+
+void usage() {
+  fprintf(stderr,
+    "Usage: offline [options]\n"
+    "  -o FILE         Write the image to FILE as a PPM (default render.ppm)\n"
+    "  -hdr FILE       Also write linear colors, after exposure, to FILE as a PFM\n"
+    "  -size W H       Image size in pixels (default 320 240)\n"
+    "  -scene FILE     Scene file written by convertScene.py, raw or .8xv\n"
+    "                  (default built in)\n"
+    "  -vars DIR       Directory holding AppVars such as textures (default .)\n"
+    "  -grain N        Trace one sample per NxN block of pixels (default 1)\n"
+    "  -supersample N  Average NxN samples for each pixel traced (default 1)\n"
+    "  -exposure X     Scale applied to each ray (default 2)\n"
+    "  -preview        Use the preview feature set rather than the final one\n");
+}
+
+/* Parses the command line, returning false if it is invalid
+ */
+bool parse_options(int argc, char** argv, Options& options) {
+  for (int i = 1; i < argc; i++) {
+    const char* arg = argv[i];
+    int remaining = argc - i - 1;
+
+    if (!strcmp(arg, "-o") && remaining >= 1) {
+      options.output = argv[++i];
+    }
+    else if (!strcmp(arg, "-hdr") && remaining >= 1) {
+      options.hdr = argv[++i];
+    }
+    else if (!strcmp(arg, "-size") && remaining >= 2) {
+      options.width = atoi(argv[++i]);
+      options.height = atoi(argv[++i]);
+    }
+    else if (!strcmp(arg, "-scene") && remaining >= 1) {
+      options.scene = argv[++i];
+    }
+    else if (!strcmp(arg, "-vars") && remaining >= 1) {
+      host_var_dir = argv[++i];
+    }
+    else if (!strcmp(arg, "-grain") && remaining >= 1) {
+      options.grain = atoi(argv[++i]);
+    }
+    else if (!strcmp(arg, "-supersample") && remaining >= 1) {
+      options.supersample = atoi(argv[++i]);
+    }
+    else if (!strcmp(arg, "-exposure") && remaining >= 1) {
+      exposure = Fixed24((float)atof(argv[++i]));
+    }
+    else if (!strcmp(arg, "-preview")) {
+      options.preview = true;
+    }
+    else {
+      return false;
+    }
+  }
+
+  return options.width > 0 && options.height > 0 &&
+         options.grain > 0 && options.supersample > 0;
+}
+
+int main(int argc, char** argv) {
+  Options options;
+
+  if (!parse_options(argc, argv, options)) {
+    usage();
+    return 1;
+  }
+
+  // Textures are read from AppVar files, either raw or as .8xv files sent to
+  // the calculator, such as bin/RTTEX1.8xv
+  load_textures();
+
+  if (options.scene) {
+    // The scene is a path, rather than a variable in the -vars directory
+    char path[256];
+    snprintf(path, sizeof(path), strchr(options.scene, '/') ? "%s" : "./%s", options.scene);
+
+    if (!load_scene(path)) {
+      fprintf(stderr, "Could not load scene %s\n", options.scene);
+      unload_textures();
+      return 1;
+    }
+  }
+  else {
+    default_scene();
+  }
+
+  room.build(planes);
+
+  int count = options.width * options.height;
+  Spectrum* linear = new Spectrum[count];
+  Color24* pixels = new Color24[count];
+
+  if (options.preview) {
+    render_image<PreviewConfig>(linear, pixels, options);
+  }
+  else {
+    render_image<FinalConfig>(linear, pixels, options);
+  }
+
+  bool ok = write_ppm(options.output, pixels, options.width, options.height);
+
+  if (ok && options.hdr) {
+    ok = write_pfm(options.hdr, linear, options.width, options.height);
+  }
+
+  if (!ok) fprintf(stderr, "Could not write the image\n");
+
+  delete[] linear;
+  delete[] pixels;
+
+  unload_textures();
+
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+/* Stands in for the parts of the CE toolchain's tice.h which the renderer
+ * uses, so its headers can be built for a desktop machine by host/offline.cpp
+ *
+ * The 24 bit integers of the ez80 are held in 32 bit ones. The fixed point
+ * routines wrap their results to 24 bits as the calculator would, see
+ * asmmath.h
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+
+typedef int32_t int24_t;
+typedef uint32_t uint24_t;
+
+#define LCD_WIDTH 320
+#define LCD_HEIGHT 240
+
+// There is no keypad, so work is never interrupted
+static inline uint8_t os_GetCSC() {
+  return 0;
+}
+
+// Homescreen output goes to stderr, leaving stdout free for images. It is
+// dropped while host_quiet is set, for example while work is repeated
+static bool host_quiet = false;
+
+static inline void os_ClrHome() {
+}
+
+static inline void os_PutStrFull(const char* str) {
+  if (!host_quiet) fputs(str, stderr);
+}
+
+static inline void os_NewLine() {
+  if (!host_quiet) fputc('\n', stderr);
+}
@@ -0,0 +1,221 @@
+#pragma once
+
+/* A thin layer over variable storage, used for saving checkpoints and loading
+ * assets at runtime
+ *
+ * On the calculator, variables are AppVars accessed through fileioc.
+ * Elsewhere they are plain files in the working directory, or in
+ * host_var_dir if it is set. A variable which has no plain file can also be
+ * read from the .8xv file which would be sent to the calculator. Names
+ * containing a '/' are paths to the file, and ignore host_var_dir
+ */
+
+#include <tice.h>
+
+#ifdef __TICE__
+#include <fileioc.h>
+typedef ti_var_t var_t;
+#else
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <string.h>
+
+// A variable stored in a file, along with the buffer returned by var_data
+struct HostVar {
+  FILE* file;
+  long end; // Offset of the end of the variable's contents in the file
+  uint8_t* data;
+};
+
+typedef HostVar* var_t;
+
+// The directory holding variables, or nullptr for the working directory
+const char* host_var_dir = nullptr;
+
+// Size of the header of a .8xv file, before its variable entry
+#define HOST_8XV_HEADER 55
+#endif
+
+#ifdef __TICE__
+var_t open_var(const char* name, const char* mode) {
+  return ti_Open(name, mode);
+}
+
+bool write_var(var_t var, const void* data, size_t size) {
+  return ti_Write(data, size, 1, var) == 1;
+}
+
+bool read_var(var_t var, void* data, size_t size) {
+  return ti_Read(data, size, 1, var) == 1;
+}
+
+/* Returns a pointer to the contents of the variable, which can be read in
+ * place even when the variable is archived. The pointer is only valid while
+ * the variable is open, and until the next time a variable is archived,
+ * since that may trigger a garbage collection which moves data around in
+ * flash
+ */
+const uint8_t* var_data(var_t var) {
+  return (const uint8_t*)ti_GetDataPtr(var);
+}
+
+size_t var_size(var_t var) {
+  return ti_GetSize(var);
+}
+
+void archive_var(var_t var) {
+  ti_SetArchiveStatus(true, var);
+}
+
+void close_var(var_t var) {
+  ti_Close(var);
+}
+
+void delete_var(const char* name) {
+  ti_Delete(name);
+}
+#else
+/* Builds the path of the file holding a variable, with the given extension.
+ * Names which are already paths are used as they are
+ */
+void host_var_path(char* path, size_t size, const char* name, const char* ext) {
+  if (host_var_dir && !strchr(name, '/')) {
+    snprintf(path, size, "%s/%s%s", host_var_dir, name, ext);
+  }
+  else {
+    snprintf(path, size, "%s%s", name, ext);
+  }
+}
+
+/* Reads a little endian 16 bit value from a file
+ */
+long host_read_u16(FILE* file) {
+  uint8_t bytes[2];
+  if (fread(bytes, 2, 1, file) != 1) return -1;
+
+  return bytes[0] | (bytes[1] << 8);
+}
+
+/* Positions a .8xv file at the start of the variable's contents, and
+ * returns the offset of their end, or -1 if the file is invalid
+ */
+long host_open_8xv(FILE* file) {
+  char signature[8];
+
+  if (fread(signature, 8, 1, file) != 1 ||
+      memcmp(signature, "**TI83F*", 8) != 0) return -1;
+
+  // The entry starts with the size of its header, then the header itself.
+  // The variable's data follows, prefixed with two copies of its size, the
+  // second of which is part of an AppVar's own contents
+  if (fseek(file, HOST_8XV_HEADER, SEEK_SET) != 0) return -1;
+
+  long header = host_read_u16(file);
+  if (header < 0 || fseek(file, header + 2, SEEK_CUR) != 0) return -1;
+
+  long size = host_read_u16(file);
+  if (size < 0) return -1;
+
+  return ftell(file) + size;
+}
+
+var_t open_var(const char* name, const char* mode) {
+  char path[256];
+  host_var_path(path, sizeof(path), name, "");
+
+  bool write = mode[0] == 'w';
+  FILE* file = fopen(path, write ? "wb" : "rb");
+  long end = 0;
+
+  // The file may be the .8xv file itself, otherwise it holds only the
+  // variable's contents
+  if (file && !write) {
+    end = host_open_8xv(file);
+
+    if (end < 0) {
+      fseek(file, 0, SEEK_END);
+      end = ftell(file);
+      fseek(file, 0, SEEK_SET);
+    }
+  }
+
+  // Fall back to the file which would be sent to the calculator
+  if (!file && !write) {
+    host_var_path(path, sizeof(path), name, ".8xv");
+    file = fopen(path, "rb");
+
+    if (file) {
+      end = host_open_8xv(file);
+
+      if (end < 0) {
+        fclose(file);
+        return nullptr;
+      }
+    }
+  }
+
+  if (!file) return nullptr;
+
+  var_t var = (var_t)malloc(sizeof(HostVar));
+  if (!var) {
+    fclose(file);
+    return nullptr;
+  }
+
+  var->file = file;
+  var->end = end;
+  var->data = nullptr;
+
+  return var;
+}
+
+bool write_var(var_t var, const void* data, size_t size) {
+  return fwrite(data, size, 1, var->file) == 1;
+}
+
+bool read_var(var_t var, void* data, size_t size) {
+  return fread(data, size, 1, var->file) == 1;
+}
+
+size_t var_size(var_t var) {
+  long start = ftell(var->file);
+
+  return var->end > start ? var->end - start : 0;
+}
+
+/* Files cannot be mapped in place, so the remaining contents are read into a
+ * buffer. As on the calculator, it is only valid until the variable is
+ * closed
+ */
+const uint8_t* var_data(var_t var) {
+  if (var->data) return var->data;
+
+  size_t size = var_size(var);
+  var->data = (uint8_t*)malloc(size ? size : 1);
+
+  if (var->data && size && !read_var(var, var->data, size)) {
+    free(var->data);
+    var->data = nullptr;
+  }
+
+  return var->data;
+}
+
+void archive_var(var_t var) {
+  (void)var;
+}
+
+void close_var(var_t var) {
+  fclose(var->file);
+  free(var->data);
+  free(var);
+}
+
+void delete_var(const char* name) {
+  char path[256];
+  host_var_path(path, sizeof(path), name, "");
+
+  remove(path);
+}
+#endif
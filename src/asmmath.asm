@@ -1,5 +1,10 @@
 public _fp_mul
 public _fp_sqr
+public _fp16_mul
+public _fp16_dot3
+public _fp_dot3
+public _fp_norm2
+public _fp_scale3
 
 ; Multiplies two Fixed24 values and returns the new value in HL
 _fp_mul:
@@ -303,6 +308,540 @@ abs_x_end_sqr:
 
   add hl, bc
 
+  pop iy
+  pop bc
+  pop ix
+  ret
+
+
+; Computes the product of the magnitudes of the Fixed16 values at (ix) and
+; (iy) with 16 fractional bits, truncated, and returns it in HL. Both values
+; are replaced with their magnitudes, and bit 0 of E is set if the product is
+; negative. Operands of 16 bits only need four partial products
+fp16_partial:
+  ld e, $0
+
+  ; Take absolute value of the operands
+  bit 7, (ix + $1)
+  jr z, abs_a_end_16
+
+  inc e
+
+  ld a, $0
+  sub a, (ix + $0)
+  ld (ix + $0), a
+
+  ld a, $0
+  sbc a, (ix + $1)
+  ld (ix + $1), a
+abs_a_end_16:
+
+  bit 7, (iy + $1)
+  jr z, abs_b_end_16
+
+  inc e
+
+  ld a, $0
+  sub a, (iy + $0)
+  ld (iy + $0), a
+
+  ld a, $0
+  sbc a, (iy + $1)
+  ld (iy + $1), a
+abs_b_end_16:
+
+  ; Multiply the high bytes, and place the result 8 bits up in HL by
+  ; reading it back from the stack one byte lower
+  ld b, (ix + $1)
+  ld c, (iy + $1)
+  mlt bc
+  push bc
+  dec sp
+  pop hl
+  inc sp
+  ld l, $0
+
+  ; Add the cross terms
+  ld b, (ix + $1)
+  ld c, (iy + $0)
+  mlt bc
+  add hl, bc
+
+  ld b, (ix + $0)
+  ld c, (iy + $1)
+  mlt bc
+  add hl, bc
+
+  ; Only the high byte of the low product is kept
+  ld b, (ix + $0)
+  ld c, (iy + $0)
+  mlt bc
+  ld c, b
+  ld b, $0
+  add hl, bc
+
+  ret
+
+
+; Multiplies two Fixed16 values and returns the new value in HL
+; The result matches _fp_mul whenever the operands and product fit in Fixed16
+_fp16_mul:
+  push ix
+  push bc
+  push iy
+
+  ; Align ix and iy to the arguments in the stack
+  ld ix, $C
+  add ix, sp
+  lea iy, ix + $3
+
+  call fp16_partial
+
+  ; Shift hl left by 4 bits, then drop the low byte, leaving 12 fractional
+  ; bits
+  add hl, hl
+  add hl, hl
+  add hl, hl
+  add hl, hl
+
+  push hl
+  inc sp
+  pop hl
+  dec sp
+
+  ; Negate the result if necessary
+  bit 0, e
+  jr z, negate_end_16
+
+  ex de, hl
+  or a, a
+  sbc hl, hl
+  sbc hl, de
+
+negate_end_16:
+
+  pop iy
+  pop bc
+  pop ix
+  ret
+
+
+; Computes the dot product of two vectors of Fixed16 values, passed as
+; x0, x1, x2, y0, y1, y2, and returns the result in HL
+; The products are summed with 16 fractional bits and rounded once at the end
+_fp16_dot3:
+  push ix
+  push bc
+  push iy
+
+  ; Align ix to x0 and iy to y0 in the stack
+  ld ix, $C
+  add ix, sp
+  lea iy, ix + $9
+
+  ld b, $3
+  ld hl, $0
+
+dot3_loop_16:
+  push bc
+  push hl
+
+  call fp16_partial
+
+  ; Negate this product if necessary, then add it to the total
+  bit 0, e
+  jr z, dot3_negate_end_16
+
+  ex de, hl
+  or a, a
+  sbc hl, hl
+  sbc hl, de
+
+dot3_negate_end_16:
+  pop de
+  add hl, de
+
+  lea ix, ix + $3
+  lea iy, iy + $3
+
+  pop bc
+  djnz dot3_loop_16
+
+  ; Round to nearest, then shift left by 4 bits and drop the low byte,
+  ; leaving 12 fractional bits
+  ld de, $8
+  add hl, de
+
+  add hl, hl
+  add hl, hl
+  add hl, hl
+  add hl, hl
+
+  push hl
+  inc sp
+  pop hl
+  dec sp
+
+  pop iy
+  pop bc
+  pop ix
+  ret
+
+
+; The vector routines below share a 20 byte frame below the saved registers,
+; addressed through ix:
+;   ix + $0   48-bit signed accumulator
+;   ix + $7   48-bit product, with one byte of spill above it
+;   ix + $E   first operand of the product
+;   ix + $11  second operand of the product
+; The arguments start at ix + $20
+
+; Multiplies the magnitudes of the two operands in the frame into a 48-bit
+; product, following the same steps as _fp_mul. Bit 0 of E is set if the
+; product is negative
+fp_mul48:
+  ; Zero-fill the product and spill byte
+  ld hl, $0
+  ld (ix + $7), hl
+  ld (ix + $A), hl
+  ld (ix + $B), hl
+
+  ld e, $0
+
+  ; Take absolute value of the operands
+  bit 7, (ix + $10)
+  jr z, abs_x_end_48
+
+  inc e
+
+  ld a, $0
+  sub a, (ix + $E)
+  ld (ix + $E), a
+
+  ld a, $0
+  sbc a, (ix + $F)
+  ld (ix + $F), a
+
+  ld a, $0
+  sbc a, (ix + $10)
+  ld (ix + $10), a
+abs_x_end_48:
+
+  bit 7, (ix + $13)
+  jr z, abs_y_end_48
+
+  inc e
+
+  ld a, $0
+  sub a, (ix + $11)
+  ld (ix + $11), a
+
+  ld a, $0
+  sbc a, (ix + $12)
+  ld (ix + $12), a
+
+  ld a, $0
+  sbc a, (ix + $13)
+  ld (ix + $13), a
+abs_y_end_48:
+
+  ; Multiply CF
+  ld h, (ix + $E)
+  ld l, (ix + $11)
+  mlt hl
+
+  ; Shift our answer over by 8 bits
+  ld (ix + $7), hl
+  ld hl, (ix + $8)
+
+  ; Multiply BF
+  ld b, (ix + $F)
+  ld c, (ix + $11)
+  mlt bc
+  add hl, bc
+
+  ; Multiply CE
+  ld b, (ix + $E)
+  ld c, (ix + $12)
+  mlt bc
+  add hl, bc
+
+  ; Shift our answer over by 8 bits
+  ld (ix + $8), hl
+  ld hl, (ix + $9)
+
+  ; Multiply AF
+  ld b, (ix + $10)
+  ld c, (ix + $11)
+  mlt bc
+  add hl, bc
+
+  ; Multiply BE
+  ld b, (ix + $F)
+  ld c, (ix + $12)
+  mlt bc
+  add hl, bc
+
+  ; Multiply CD
+  ld b, (ix + $E)
+  ld c, (ix + $13)
+  mlt bc
+  add hl, bc
+
+  ; Shift our answer over by 8 bits
+  ld (ix + $9), hl
+  ld hl, (ix + $A)
+
+  ; Multiply BD
+  ld b, (ix + $F)
+  ld c, (ix + $13)
+  mlt bc
+  add hl, bc
+
+  ; Multiply AE
+  ld b, (ix + $10)
+  ld c, (ix + $12)
+  mlt bc
+  add hl, bc
+
+  ; Shift our answer over by 8 bits
+  ld (ix + $A), hl
+  ld hl, (ix + $B)
+
+  ; Multiply AD
+  ld b, (ix + $10)
+  ld c, (ix + $13)
+  mlt bc
+  add hl, bc
+
+  ld (ix + $B), hl
+
+  ret
+
+
+; Adds the product to the accumulator, or subtracts it if bit 0 of E is set
+fp_acc48:
+  bit 0, e
+
+  lea hl, ix + $7
+  lea de, ix + $0
+  ld b, $6
+
+  jr nz, acc_sub_48
+
+  or a, a
+acc_add_loop_48:
+  ld a, (de)
+  adc a, (hl)
+  ld (de), a
+  inc hl
+  inc de
+  djnz acc_add_loop_48
+
+  ret
+
+acc_sub_48:
+  or a, a
+acc_sub_loop_48:
+  ld a, (de)
+  sbc a, (hl)
+  ld (de), a
+  inc hl
+  inc de
+  djnz acc_sub_loop_48
+
+  ret
+
+
+; Rounds the accumulator to the nearest Fixed24 value and returns it in HL
+fp_round48:
+  ; Add half of the lowest bit kept
+  ld a, (ix + $1)
+  add a, $8
+  ld (ix + $1), a
+
+  ld hl, (ix + $2)
+  jr nc, round_carry_end_48
+  inc hl
+round_carry_end_48:
+
+  ; Shift hl left by 4 bits, and fill the low bits from the byte below
+  add hl, hl
+  add hl, hl
+  add hl, hl
+  add hl, hl
+
+  ld a, (ix + $1)
+  rrca
+  rrca
+  rrca
+  rrca
+  and a, $F
+  or a, l
+  ld l, a
+
+  ret
+
+
+; Computes the dot product of two vectors of Fixed24 values, passed as
+; x0, x1, x2, y0, y1, y2, and returns the result in HL
+; The products are summed at full 48-bit precision and rounded once
+_fp_dot3:
+  push ix
+  push bc
+  push iy
+
+  ; Reserve the frame
+  ld ix, $FFFFEC
+  add ix, sp
+  ld sp, ix
+
+  ld hl, $0
+  ld (ix + $0), hl
+  ld (ix + $3), hl
+
+  ; Align iy to x0 in the stack
+  lea iy, ix + $20
+
+  ld b, $3
+dot3_loop:
+  push bc
+
+  ld hl, (iy + $0)
+  ld (ix + $E), hl
+  ld hl, (iy + $9)
+  ld (ix + $11), hl
+
+  call fp_mul48
+  call fp_acc48
+
+  lea iy, iy + $3
+
+  pop bc
+  djnz dot3_loop
+
+  call fp_round48
+
+  lea iy, ix + $14
+  ld sp, iy
+
+  pop iy
+  pop bc
+  pop ix
+  ret
+
+
+; Computes the squared length of a vector of Fixed24 values, passed as
+; x, y, z, and returns the result in HL
+; The squares are summed at full 48-bit precision and rounded once
+_fp_norm2:
+  push ix
+  push bc
+  push iy
+
+  ; Reserve the frame
+  ld ix, $FFFFEC
+  add ix, sp
+  ld sp, ix
+
+  ld hl, $0
+  ld (ix + $0), hl
+  ld (ix + $3), hl
+
+  ; Align iy to x in the stack
+  lea iy, ix + $20
+
+  ld b, $3
+norm2_loop:
+  push bc
+
+  ld hl, (iy + $0)
+  ld (ix + $E), hl
+  ld (ix + $11), hl
+
+  call fp_mul48
+  call fp_acc48
+
+  lea iy, iy + $3
+
+  pop bc
+  djnz norm2_loop
+
+  call fp_round48
+
+  lea iy, ix + $14
+  ld sp, iy
+
+  pop iy
+  pop bc
+  pop ix
+  ret
+
+
+; Multiplies each of the three Fixed24 values pointed to by the first
+; argument by the second argument, in place
+; Each result matches _fp_mul exactly
+_fp_scale3:
+  push ix
+  push bc
+  push iy
+
+  ; Reserve the frame
+  ld ix, $FFFFEC
+  add ix, sp
+  ld sp, ix
+
+  ld iy, (ix + $20)
+
+  ld b, $3
+scale3_loop:
+  push bc
+
+  ld hl, (iy + $0)
+  ld (ix + $E), hl
+  ld hl, (ix + $23)
+  ld (ix + $11), hl
+
+  call fp_mul48
+
+  ; Take the 24 bits of the product above the 12 fractional bits, as in
+  ; _fp_mul
+  ld hl, (ix + $9)
+
+  add hl, hl
+  add hl, hl
+  add hl, hl
+  add hl, hl
+
+  ld a, (ix + $8)
+  rrca
+  rrca
+  rrca
+  rrca
+  and a, $F
+  or a, l
+  ld l, a
+
+  ; Negate the result if necessary
+  bit 0, e
+  jr z, scale3_negate_end
+
+  ex de, hl
+  or a, a
+  sbc hl, hl
+  sbc hl, de
+
+scale3_negate_end:
+  ld (iy + $0), hl
+
+  lea iy, iy + $3
+
+  pop bc
+  djnz scale3_loop
+
+  lea iy, ix + $14
+  ld sp, iy
+
   pop iy
   pop bc
   pop ix
@@ -1,4 +1,89 @@
+#ifdef __TICE__
 extern "C" {
   int24_t fp_mul(int24_t x, int24_t y);
   int24_t fp_sqr(int24_t x);
-}
\ No newline at end of file
+  int24_t fp_dot3(int24_t x0, int24_t x1, int24_t x2,
+                  int24_t y0, int24_t y1, int24_t y2);
+  int24_t fp_norm2(int24_t x, int24_t y, int24_t z);
+  void fp_scale3(int24_t* v, int24_t s);
+  int16_t fp16_mul(int16_t x, int16_t y);
+  int16_t fp16_dot3(int16_t x0, int16_t x1, int16_t x2,
+                    int16_t y0, int16_t y1, int16_t y2);
+}
+#else
+/* Reference implementations of the routines in asmmath.asm for other
+ * platforms, giving the same results bit for bit
+ */
+
+// Keeps only the low 24 bits of a value, sign extended, as an ez80 register
+// would hold it
+static inline int32_t fp_wrap(int64_t x) {
+  x &= 0xFFFFFF;
+
+  return (int32_t)(x & 0x800000 ? x - 0x1000000 : x);
+}
+
+// Multiplies the magnitudes and truncates to 12 fractional bits, then
+// applies the sign
+inline int24_t fp_mul(int24_t x, int24_t y) {
+  int64_t mx = fp_wrap(x);
+  int64_t my = fp_wrap(y);
+  bool negative = (mx < 0) != (my < 0);
+
+  mx = mx < 0 ? -mx : mx;
+  my = my < 0 ? -my : my;
+
+  int64_t out = (mx * my) >> 12;
+
+  return fp_wrap(negative ? -out : out);
+}
+
+inline int24_t fp_sqr(int24_t x) {
+  return fp_mul(x, x);
+}
+
+// Sums the full products, then rounds to nearest
+inline int24_t fp_dot3(int24_t x0, int24_t x1, int24_t x2,
+                       int24_t y0, int24_t y1, int24_t y2) {
+  int64_t sum = (int64_t)fp_wrap(x0) * fp_wrap(y0) +
+                (int64_t)fp_wrap(x1) * fp_wrap(y1) +
+                (int64_t)fp_wrap(x2) * fp_wrap(y2);
+
+  return fp_wrap((sum + 0x800) >> 12);
+}
+
+inline int24_t fp_norm2(int24_t x, int24_t y, int24_t z) {
+  return fp_dot3(x, y, z, x, y, z);
+}
+
+inline void fp_scale3(int24_t* v, int24_t s) {
+  v[0] = fp_mul(v[0], s);
+  v[1] = fp_mul(v[1], s);
+  v[2] = fp_mul(v[2], s);
+}
+
+// Product of the magnitudes with 16 fractional bits, truncated
+static inline int32_t fp16_partial(int16_t x, int16_t y) {
+  int32_t mx = x < 0 ? -(int32_t)x : x;
+  int32_t my = y < 0 ? -(int32_t)y : y;
+
+  return (mx * my) >> 8;
+}
+
+inline int16_t fp16_mul(int16_t x, int16_t y) {
+  int32_t out = fp16_partial(x, y) >> 4;
+
+  return (int16_t)((x < 0) != (y < 0) ? -out : out);
+}
+
+inline int16_t fp16_dot3(int16_t x0, int16_t x1, int16_t x2,
+                         int16_t y0, int16_t y1, int16_t y2) {
+  int32_t sum = 0;
+
+  sum += (x0 < 0) != (y0 < 0) ? -fp16_partial(x0, y0) : fp16_partial(x0, y0);
+  sum += (x1 < 0) != (y1 < 0) ? -fp16_partial(x1, y1) : fp16_partial(x1, y1);
+  sum += (x2 < 0) != (y2 < 0) ? -fp16_partial(x2, y2) : fp16_partial(x2, y2);
+
+  return (int16_t)((sum + 8) >> 4);
+}
+#endif
\ No newline at end of file
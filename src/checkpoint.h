@@ -0,0 +1,202 @@
+#pragma once
+
+/* Saves and restores the progress of the long running parts of the program
+ * (radiosity and rendering), so they can be interrupted with a keypress and
+ * resumed later from where they stopped
+ *
+ * On the calculator, checkpoints are stored in archived AppVars so they
+ * survive a RAM clear. Elsewhere they are stored as files in the working
+ * directory
+ */
+
+#include <tice.h>
+#include "color.h"
+#include "scene.h"
+#include "appvar.h"
+#include "palette.h"
+#include "lightcache.h"
+
+// Bumped whenever the layout of the saved state changes, so old checkpoints
+// are ignored rather than misread
+#define CHECKPOINT_VERSION 7
+
+// Rows of the framebuffer stored in each AppVar, so each stays well below the
+// maximum variable size
+#define CHECKPOINT_ROWS 32
+
+// Stages of the program, in the order they are run
+enum Stage { STAGE_PLANES, STAGE_SPHERES, STAGE_RENDER };
+
+struct Progress {
+  uint8_t version;
+  uint8_t plane_count;  // Size of the scene the checkpoint belongs to
+  uint8_t sphere_count;
+  uint8_t stage;
+  uint8_t bounce;  // Radiosity bounce being computed
+  uint8_t object;  // Index of the plane or sphere being computed
+  uint8_t row;     // Next lightmap row of that object
+  uint8_t segment; // Supersampled segment being rendered
+  int24_t y;       // Next scanline to render
+  uint8_t pixel;   // Size of a framebuffer pixel, which depends on the build
+  uint8_t updates; // Times lighting has been updated from a saved solution,
+                   // or 0 if it is being computed from scratch
+  Vec3 camera;     // Camera the saved rows were rendered from
+};
+
+Progress progress = { CHECKPOINT_VERSION, 0, 0, STAGE_PLANES, 0, 0, 0, 0, 0, sizeof(Pixel), 0, Vec3() };
+
+const char* state_name = "RTSTATE";
+
+/* Returns true if a key has been pressed, which requests that the program
+ * save its progress and exit
+ */
+bool interrupted() {
+  return os_GetCSC() != 0;
+}
+
+/* Builds the name of the AppVar holding the given chunk of the framebuffer
+ */
+void chunk_name(char* name, uint8_t chunk) {
+  name[0] = 'R';
+  name[1] = 'T';
+  name[2] = 'F';
+  name[3] = 'B';
+  name[4] = '0' + chunk;
+  name[5] = '\0';
+}
+
+/* Saves the current progress, a description of the scene it belongs to, the
+ * state of all lightmaps, and any completed rows of the framebuffer
+ */
+bool save_checkpoint(volatile Pixel* framebuffer) {
+  var_t var = open_var(state_name, "w");
+  if (!var) return false;
+
+  progress.plane_count = planes.count;
+  progress.sphere_count = spheres.count;
+  progress.pixel = sizeof(Pixel);
+  progress.camera = cam_origin;
+
+  LightCache scene;
+  scene.describe(progress.updates);
+
+  bool ok = write_var(var, &progress, sizeof(progress)) &&
+            write_var(var, &scene, sizeof(scene));
+
+  ok = ok && write_var(var, plane_maps, planes.count * sizeof(LightMap));
+  ok = ok && write_var(var, sphere_irradiance, spheres.count * sizeof(SphereIrradiance));
+
+  archive_var(var);
+  close_var(var);
+
+  if (progress.stage != STAGE_RENDER) return ok;
+
+  // Store the rows rendered so far in chunks
+  for (int24_t y = 0; y < progress.y; y += CHECKPOINT_ROWS) {
+    int24_t rows = progress.y - y;
+    if (rows > CHECKPOINT_ROWS) rows = CHECKPOINT_ROWS;
+
+    char name[6];
+    chunk_name(name, y / CHECKPOINT_ROWS);
+
+    var = open_var(name, "w");
+    if (!var) return false;
+
+    ok = ok && write_var(var, (const Pixel*)framebuffer + (LCD_WIDTH * y),
+                         rows * LCD_WIDTH * sizeof(Pixel));
+
+    archive_var(var);
+    close_var(var);
+  }
+
+  return ok;
+}
+
+/* Restores progress saved by a previous run, if there is any. Returns false
+ * if the program should start from the beginning, which includes when the
+ * checkpoint was saved for a different scene
+ *
+ * The rendered rows are restored separately by load_framebuffer, since in
+ * palette mode there is nowhere to put them until lighting has finished
+ */
+bool load_checkpoint() {
+  var_t var = open_var(state_name, "r");
+  if (!var) return false;
+
+  Progress saved;
+  LightCache scene;
+  bool ok = read_var(var, &saved, sizeof(saved)) &&
+            saved.version == CHECKPOINT_VERSION &&
+            read_var(var, &scene, sizeof(scene)) &&
+            scene.same_scene();
+
+  // Rows rendered from elsewhere are of no use, but the lighting still is
+  if (ok && !same_vec(saved.camera, cam_origin)) {
+    saved.segment = 0;
+    saved.y = 0;
+  }
+
+  ok = ok && read_var(var, plane_maps, planes.count * sizeof(LightMap));
+  ok = ok && read_var(var, sphere_irradiance, spheres.count * sizeof(SphereIrradiance));
+
+  close_var(var);
+
+  if (!ok) return false;
+
+  progress = saved;
+
+  return true;
+}
+
+/* Restores the rows rendered before the checkpoint was saved to the
+ * framebuffer. If they are missing or were saved by a build with a different
+ * framebuffer format, rendering starts again from the top
+ */
+void load_framebuffer(volatile Pixel* framebuffer) {
+  if (progress.stage != STAGE_RENDER) return;
+
+  if (progress.pixel != sizeof(Pixel)) {
+    progress.y = 0;
+    return;
+  }
+
+  // Restore the rendered rows to the screen
+  for (int24_t y = 0; y < progress.y; y += CHECKPOINT_ROWS) {
+    int24_t rows = progress.y - y;
+    if (rows > CHECKPOINT_ROWS) rows = CHECKPOINT_ROWS;
+
+    char name[6];
+    chunk_name(name, y / CHECKPOINT_ROWS);
+
+    var_t var = open_var(name, "r");
+
+    // Without the framebuffer, rendering must start again from the top
+    if (!var) {
+      progress.y = 0;
+      return;
+    }
+
+    bool ok = read_var(var, (Pixel*)framebuffer + (LCD_WIDTH * y),
+                       rows * LCD_WIDTH * sizeof(Pixel));
+
+    close_var(var);
+
+    if (!ok) {
+      progress.y = 0;
+      return;
+    }
+  }
+}
+
+/* Removes any saved checkpoint once the job it belongs to has finished
+ */
+void clear_checkpoint() {
+  delete_var(state_name);
+
+  for (uint8_t chunk = 0; chunk < LCD_HEIGHT / CHECKPOINT_ROWS + 1; chunk++) {
+    char name[6];
+    chunk_name(name, chunk);
+
+    delete_var(name);
+  }
+}
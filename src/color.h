@@ -66,12 +66,35 @@ Color bilinear(Color tex00, Color tex10, Color tex01, Color tex11,
   return lerp(lerp(tex00, tex10, sub_x), lerp(tex01, tex11, sub_x), sub_y);
 }
 
+// Thresholds for ordered dithering, from a 4x4 Bayer matrix. Each of the 8
+// possible values of the 3 bits dropped from a channel appears twice, so on
+// average a color is rounded down exactly as often as it should be
+const uint8_t dither_matrix[4][4] = {
+  { 0, 4, 1, 5 },
+  { 6, 2, 7, 3 },
+  { 1, 5, 0, 4 },
+  { 7, 3, 6, 2 }
+};
+
+/* Returns the ordered dithering threshold for a pixel, which depends only on
+ * its position, so pixels can be quantized in any order
+ */
+uint8_t dither_threshold(int24_t x, int24_t y) {
+  return dither_matrix[y & 3][x & 3];
+}
+
 // A 24-bit color struct to preserve some precision while dithering the output
 struct Color24 {
   uint8_t r;
   uint8_t g;
   uint8_t b;
 
+  Color24() {
+    r = 0;
+    g = 0;
+    b = 0;
+  }
+
   Color24(uint8_t _r, uint8_t _g, uint8_t _b) {
     r = _r;
     g = _g;
@@ -91,6 +114,29 @@ struct Color24 {
     return fromRGB(r >> 3, g >> 3, b >> 3);
   }
 
+  /* Adds an ordered dithering threshold to each channel, then rounds down
+   * to 5 bits and constructs a 16-bit color
+   */
+  Color toColor16(uint8_t threshold) {
+    uint8_t _r = r + threshold;
+    uint8_t _g = g + threshold;
+    uint8_t _b = b + threshold;
+
+    // Clamp this addition if it ever overflows
+    if (_r < r) _r = 255;
+    if (_g < g) _g = 255;
+    if (_b < b) _b = 255;
+
+    return fromRGB(_r >> 3, _g >> 3, _b >> 3);
+  }
+
+  /* Rounds down each channel to 5 bits and constructs a 16-bit color,
+   * discarding the rounding error
+   */
+  Color toColor16() {
+    return fromRGB(r >> 3, g >> 3, b >> 3);
+  }
+
   void operator+=(Color24& c) {
     r += c.r;
     g += c.g;
@@ -0,0 +1,93 @@
+import json
+import struct
+import sys
+
+# Converts a scene description in JSON to the binary scene format read by
+# sceneFile.h. See scenes/cornell.json for an example of the input.
+#
+# Usage: python convertScene.py <scene.json> <output>
+#
+# If the output ends in .8xv, an archived AppVar named RTSCENE is written which
+# can be sent to the calculator. Otherwise the raw scene data is written.
+
+VAR_NAME = b'RTSCENE'
+VERSION = 2
+
+# Light intensities must be below this, as in scene.h
+MAX_LIGHT_INTENSITY = 8
+
+def fixed(x):
+  # Matches the truncation of the Fixed24 float constructor
+  n = int(x * 4096)
+  return struct.pack('<i', n)[:3]
+
+def vec(v):
+  return b''.join(fixed(x) for x in v)
+
+def color(rgb):
+  r, g, b = rgb
+  return struct.pack('<H', (r << 11) | (g << 6) | b)
+
+def build_scene(scene):
+  materials = scene['materials']
+  planes = scene['planes']
+  spheres = scene['spheres']
+
+  # A single "light" position is still accepted, as a light of intensity 1
+  if 'lights' in scene:
+    lights = scene['lights']
+  else:
+    lights = [{'position': scene['light']}]
+
+  out = b'RTSC' + bytes([VERSION, len(materials), len(planes), len(spheres), len(lights)])
+  out += vec(scene.get('camera', [0, 0, 0]))
+
+  for m in materials:
+    flags = 1 if m.get('reflective', False) else 0
+    out += color(m['color']) + bytes([m.get('texture', 0), flags])
+
+  for p in planes:
+    if sorted(abs(x) for x in p['normal']) != [0, 0, 1]:
+      sys.exit('Plane normal %s must be +-x, +-y or +-z' % p['normal'])
+
+    out += vec(p['point']) + vec(p['normal']) + bytes([p['material']])
+
+  for s in spheres:
+    if int(s['radius'] * 4096) <= 0:
+      sys.exit('Sphere radius %s must be above 0' % s['radius'])
+
+    out += vec(s['center']) + fixed(s['radius']) + bytes([s['material']])
+
+  for l in lights:
+    intensity = l.get('intensity', 1.0)
+
+    if not 0 <= intensity < MAX_LIGHT_INTENSITY:
+      sys.exit('Light intensity %s must be at least 0 and below %d' % (intensity, MAX_LIGHT_INTENSITY))
+
+    out += vec(l['position']) + fixed(intensity)
+
+  return out
+
+# Wraps data in the TI-84 Plus CE variable file format as an archived AppVar
+def build_appvar(name, data, description=b'Raytracer scene'):
+  var_data = struct.pack('<H', len(data)) + data
+
+  entry = struct.pack('<HHB', 0x0D, len(var_data), 0x15)
+  entry += name.ljust(8, b'\0')
+  entry += bytes([0, 0x80])
+  entry += struct.pack('<H', len(var_data)) + var_data
+
+  header = b'**TI83F*\x1a\x0a\x00' + description.ljust(42, b'\0')
+  header += struct.pack('<H', len(entry))
+
+  return header + entry + struct.pack('<H', sum(entry) & 0xFFFF)
+
+if __name__ == '__main__':
+  with open(sys.argv[1]) as f:
+    data = build_scene(json.load(f))
+
+  if sys.argv[2].endswith('.8xv'):
+    data = build_appvar(VAR_NAME, data)
+
+  with open(sys.argv[2], 'wb') as f:
+    f.write(data)
@@ -1,23 +1,47 @@
+import struct
+import sys
+
 import numpy as np
 import cv2
 
-# Converts an image file to the Ti84's color format, and prints the output
-# to be included in a header file.
+from convertScene import build_appvar
+
+# Converts an image file to the Ti84's color format, in the texture format read
+# by texture.h
+#
+# Usage: python convertTex.py <image> <output> [name]
+#
+# If the output ends in .8xv, an archived AppVar with the given name (RTTEX1 by
+# default) is written which can be sent to the calculator. Otherwise the raw
+# texture data is written. Scenes refer to RTTEX1 as texture 1, RTTEX2 as
+# texture 2 and so on.
+#
+# Images must be square, with sides of a power of 2 up to 128 pixels.
+
+VERSION = 1
+MAX_BITS = 7
 
-# The file to convert
-path = "../Floor128.bmp"
+path = sys.argv[1]
+output = sys.argv[2]
+name = sys.argv[3] if len(sys.argv) > 3 else 'RTTEX1'
 
 img = cv2.imread(path)
 
+size = img.shape[0]
+bits = size.bit_length() - 1
+
+if img.shape[1] != size or size != (1 << bits) or bits > MAX_BITS:
+  sys.exit('%s must be square, with sides of a power of 2 up to %d' % (path, 1 << MAX_BITS))
+
 # Convert all channels to 5-bit color
 lowRGB = (img // (256 / 32)).astype(np.uint16)
 
 tiRGB = lowRGB[:,:,0] + (lowRGB[:,:,1] * (2 ** 6)) + (lowRGB[:,:,2] * (2 ** 11))
 
-# Print output into a format which can be dropped into a header file
-for row in tiRGB:
-  line = ''
-  for pixel in row:
-    line += '0x%x, ' % pixel
+data = b'RTTX' + bytes([VERSION, bits]) + tiRGB.astype('<u2').tobytes()
+
+if output.endswith('.8xv'):
+  data = build_appvar(name.encode(), data, b'Raytracer texture')
 
-  print('{%s},' % line[:-2])
\ No newline at end of file
+with open(output, 'wb') as f:
+  f.write(data)
\ No newline at end of file
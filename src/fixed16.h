@@ -0,0 +1,84 @@
+#pragma once
+
+/* Reduced range (4.12) fixed point arithmetic for quantities known to be
+ * small, such as unit normals, Lambert terms and albedos
+ *
+ * Fixed16 keeps the 12 fractional bits of Fixed24 but only 4 integer bits,
+ * so values must lie in [-8, 8). In exchange, a multiply needs four 8-bit
+ * MLT partial products instead of nine, and fp16_dot3 sums three products in
+ * one call.
+ *
+ * Error bounds, in units of 2^-12 (one Fixed24 ulp):
+ * - mul16 gives exactly the same result as Fixed24 multiplication whenever
+ *   both operands and the product lie in [-8, 8)
+ * - dot16 sums the products with 16 fractional bits and rounds once, so it is
+ *   within 0.7 of the exact dot product. Fixed24 dot also rounds the full
+ *   sum once, so is within 0.5, and the two differ by at most 1
+ */
+
+#include <tice.h>
+#include "fixedpoint.h"
+#include "vector.h"
+
+struct Fixed16 {
+  int16_t n;
+
+  Fixed16() {
+    n = 0;
+  }
+
+  // Narrows a Fixed24, which must lie in [-8, 8)
+  Fixed16(Fixed24 x) {
+    n = (int16_t)x.n;
+  }
+
+  Fixed24 toFixed24() const {
+    Fixed24 out;
+
+    out.n = n;
+
+    return out;
+  }
+
+  Fixed16 operator*(Fixed16 v) const {
+    Fixed16 out;
+
+    out.n = fp16_mul(n, v.n);
+
+    return out;
+  }
+};
+
+// Largest component a vector can have in dot16, so that its length (and so
+// its dot product with a unit vector) stays below 8
+const int24_t fixed16_dot_limit = 0x4800;
+
+/* Multiplies two Fixed24 values which are known to lie in [-8, 8) with a
+ * product also in that range, such as an albedo and a clamped attenuation
+ */
+Fixed24 mul16(Fixed24 a, Fixed24 b) {
+  COUNT_OP(OP_MUL);
+
+  return (Fixed16(a) * Fixed16(b)).toFixed24();
+}
+
+/* Computes the dot product of a unit vector with another vector. If the
+ * second vector is too large for the result to fit in Fixed16 this falls
+ * back to Fixed24, so it is safe for arbitrary scenes
+ */
+Fixed24 dot16(Vec3& unit, Vec3& v) {
+  for (uint8_t i = 0; i < 3; i++) {
+    if (v[i].n < -fixed16_dot_limit || v[i].n > fixed16_dot_limit) {
+      return dot(unit, v);
+    }
+  }
+
+  COUNT_OPS_N(OP_MUL, 3);
+
+  Fixed24 out;
+
+  out.n = fp16_dot3(Fixed16(unit.x).n, Fixed16(unit.y).n, Fixed16(unit.z).n,
+                    Fixed16(v.x).n, Fixed16(v.y).n, Fixed16(v.z).n);
+
+  return out;
+}
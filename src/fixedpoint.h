@@ -11,6 +11,7 @@
 
 #include <tice.h>
 #include "asmmath.h"
+#include "profiler.h"
 #include <math.h>
 
 const char* digits = "0123456789ABCDEF";
@@ -51,6 +52,7 @@ struct Fixed24 {
   Fixed24 operator+(Fixed24 v) const {
     Fixed24 out;
 
+    COUNT_OP(OP_ADD);
     out.n = n + v.n;
 
     return out;
@@ -59,6 +61,7 @@ struct Fixed24 {
   Fixed24 operator-(Fixed24 v) const {
     Fixed24 out;
 
+    COUNT_OP(OP_ADD);
     out.n = n - v.n;
 
     return out;
@@ -68,6 +71,7 @@ struct Fixed24 {
     Fixed24 out;
 
     // Invokes a specialized asm routine implemented in asmtest.asm
+    COUNT_OP(OP_MUL);
     out.n = fp_mul(n, v.n);
 
     return out;
@@ -76,16 +80,19 @@ struct Fixed24 {
   Fixed24 operator-() const {
     Fixed24 out;
     
+    COUNT_OP(OP_ADD);
     out.n = -n;
 
     return out;
   }
 
   void operator+=(Fixed24 v) {
+    COUNT_OP(OP_ADD);
     n += v.n;
   }
 
   void operator-=(Fixed24 v) {
+    COUNT_OP(OP_ADD);
     n -= v.n;
   }
 
@@ -138,6 +145,8 @@ void print_fixed(Fixed24 &x) {
  */
 Fixed24 sqrt(Fixed24 &x) {
 
+  COUNT_OP(OP_SQRT);
+
   // Convert to a float, take sqrt, then convert back
   float f = x.n / (float)(1 << POINT);
 
@@ -152,21 +161,39 @@ Fixed24 sqrt(Fixed24 &x) {
 Fixed24 sqr(Fixed24 x) {
 
   Fixed24 out;
+  COUNT_OP(OP_SQR);
   out.n = fp_sqr(x.n);
 
   return out;
 }
 
-/* Computes division of larger numbers by multiplying a by the reciprocal of b
- * This is slow and imprecise for certain values of b, so it should be replaced 
- * by an ASM routine
+/* Computes the reciprocal of b. Values of b very close to zero have
+ * reciprocals too large to represent, so they saturate to the largest value
+ * of the same sign instead
  */
-Fixed24 div(Fixed24 a, Fixed24 b) {
+Fixed24 recip(Fixed24 b) {
   Fixed24 reciprocal;
 
+  if (b.n >= -2 && b.n <= 2) {
+    reciprocal.n = b.n < 0 ? -0x7FFFFF : 0x7FFFFF;
+    return reciprocal;
+  }
+
+  COUNT_OP(OP_DIV);
   reciprocal.n = (((int32_t)(1 << POINT)) << POINT) / (int32_t)b.n;
 
-  return a * reciprocal;
+  return reciprocal;
+}
+
+/* Computes division of larger numbers by multiplying a by the reciprocal of b
+ * This is slow and imprecise for certain values of b, so it should be replaced 
+ * by an ASM routine
+ *
+ * When dividing several values by the same b, it is faster to compute the
+ * reciprocal once with recip and multiply by it, which gives the same result
+ */
+Fixed24 div(Fixed24 a, Fixed24 b) {
+  return a * recip(b);
 }
 
 /* Clamps the Fixed24 to be within the range 0 and 1 inclusively
@@ -257,6 +284,7 @@ int24_t asin_table[65]{ -4096,
 Fixed24 asin(Fixed24 x) {
   Fixed24 out;
 
+  COUNT_OP(OP_LUT);
   out.n = asin_table[(x + Fixed24(1)).floor(5)];
 
   return out;
@@ -281,5 +309,5 @@ Fixed24 atan2(Fixed24 &x, Fixed24 &y) {
   Fixed24 a = Fixed24(1) + asin(-norm_x);
   a.n >>= 1;
 
-  return y > Fixed24(0) ? a : Fixed24(2) - a;\
+  return y > Fixed24(0) ? a : Fixed24(2) - a;
 }
\ No newline at end of file
@@ -0,0 +1,80 @@
+#pragma once
+
+/* Stores the light arriving at a diffuse sphere as second order spherical
+ * harmonics about its center, from which the irradiance for any normal can be
+ * evaluated with a handful of multiplies
+ *
+ * Irradiance is the incoming light weighted by the clamped cosine
+ * max(0, n.w), which is smooth enough that its first three Legendre terms
+ * 3/32 + (n.w)/2 + 15/32 (n.w)^2 capture nearly all of it. Summed over every
+ * incoming direction w, this leaves a constant, a linear and a quadratic
+ * function of the normal. Since the normal has unit length the constant is
+ * folded into the squared terms, leaving 9 coefficients per channel, the same
+ * as the usual 9 spherical harmonic coefficients, which span these functions
+ */
+
+#include "spectrum.h"
+#include "vector.h"
+
+struct SphereIrradiance {
+  Spectrum linear[3]; // x, y, z
+  Spectrum square[3]; // xx, yy, zz
+  Spectrum cross[3];  // xy, yz, zx
+
+  void clear() {
+    for (uint8_t i = 0; i < 3; i++) {
+      linear[i] = Spectrum();
+      square[i] = Spectrum();
+      cross[i] = Spectrum();
+    }
+  }
+
+  /* Adds light arriving from the unit direction dir
+   */
+  void add(Spectrum radiance, Vec3& dir) {
+    const Fixed24 half(0.5f);
+    const Fixed24 constant(3.0f / 32);
+    const Fixed24 quadratic(15.0f / 32);
+    const Fixed24 mixed(15.0f / 16);
+
+    for (uint8_t i = 0; i < 3; i++) {
+      uint8_t j = i == 2 ? 0 : i + 1;
+
+      linear[i] += radiance * (dir[i] * half);
+      square[i] += radiance * (sqr(dir[i]) * quadratic + constant);
+      cross[i] += radiance * (dir[i] * dir[j] * mixed);
+    }
+  }
+
+  /* Scales all of the stored light
+   */
+  void scale(Fixed24 s) {
+    for (uint8_t i = 0; i < 3; i++) {
+      linear[i] = linear[i] * s;
+      square[i] = square[i] * s;
+      cross[i] = cross[i] * s;
+    }
+  }
+
+  /* Evaluates the irradiance on the surface with this unit normal
+   */
+  Spectrum sample(Vec3& normal) {
+    Spectrum out;
+
+    for (uint8_t i = 0; i < 3; i++) {
+      uint8_t j = i == 2 ? 0 : i + 1;
+
+      out += linear[i] * normal[i];
+      out += square[i] * sqr(normal[i]);
+      out += cross[i] * (normal[i] * normal[j]);
+    }
+
+    // The truncated series can ring slightly below zero facing away from
+    // bright surfaces
+    out.r = clamp0(out.r);
+    out.g = clamp0(out.g);
+    out.b = clamp0(out.b);
+
+    return out;
+  }
+};
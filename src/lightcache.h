@@ -0,0 +1,157 @@
+#pragma once
+
+/* Keeps the finished lighting of the last scene lit, so that after a small
+ * edit to the scene (moving the lights or spheres) radiosity can be updated
+ * from it rather than computed again from nothing
+ *
+ * The cache is stored in the RTLIGHT AppVar, and is only used if everything
+ * else the lighting depends on is unchanged. That is the planes and their
+ * albedos, and which spheres are reflective. Each update adds a little
+ * rounding error, so after LIGHT_CACHE_MAX_UPDATES in a row the lighting is
+ * computed from scratch again
+ */
+
+#include <tice.h>
+#include "scene.h"
+#include "appvar.h"
+
+// Bumped whenever the layout of the cache changes
+#define LIGHT_CACHE_VERSION 3
+
+#define LIGHT_CACHE_MAX_UPDATES 8
+
+const char* light_cache_name = "RTLIGHT";
+
+bool same_vec(const Vec3& a, const Vec3& b) {
+  return a.x.n == b.x.n && a.y.n == b.y.n && a.z.n == b.z.n;
+}
+
+/* Describes the scene a cached solution was computed for. The plane
+ * lightmaps follow it in the AppVar
+ */
+struct LightCache {
+  uint8_t version;
+  uint8_t plane_count;
+  uint8_t sphere_count;
+  uint8_t updates; // Updates made since lighting was computed from scratch
+
+  // Parts of the scene which may have moved since
+  Lights lights;
+  Vec3 sphere_point[MAX_SPHERES];
+  Fixed24 sphere_radius[MAX_SPHERES];
+
+  // Parts of the scene which must be unchanged
+  Vec3 plane_point[MAX_PLANES];
+  Vec3 plane_normal[MAX_PLANES];
+  Spectrum plane_albedo[MAX_PLANES];
+  bool reflective[MAX_SPHERES];
+
+  /* Describes the current scene
+   */
+  void describe(uint8_t _updates) {
+    version = LIGHT_CACHE_VERSION;
+    plane_count = planes.count;
+    sphere_count = spheres.count;
+    updates = _updates;
+
+    lights = ::lights;
+
+    for (uint8_t i = 0; i < spheres.count; i++) {
+      sphere_point[i] = spheres.point[i];
+      sphere_radius[i] = spheres.radius[i];
+      reflective[i] = sphere_materials[i].reflective;
+    }
+
+    for (uint8_t i = 0; i < planes.count; i++) {
+      plane_point[i] = planes.point[i];
+      plane_normal[i] = planes.normal[i];
+      plane_albedo[i] = plane_materials[i].albedo;
+    }
+  }
+
+  /* Returns true if this solution can be updated to the current scene
+   */
+  bool matches_scene() {
+    if (version != LIGHT_CACHE_VERSION ||
+        plane_count != planes.count ||
+        sphere_count != spheres.count) return false;
+
+    for (uint8_t i = 0; i < spheres.count; i++) {
+      if (reflective[i] != sphere_materials[i].reflective) return false;
+    }
+
+    for (uint8_t i = 0; i < planes.count; i++) {
+      Spectrum& albedo = plane_materials[i].albedo;
+
+      if (!same_vec(plane_point[i], planes.point[i]) ||
+          !same_vec(plane_normal[i], planes.normal[i]) ||
+          plane_albedo[i].r.n != albedo.r.n ||
+          plane_albedo[i].g.n != albedo.g.n ||
+          plane_albedo[i].b.n != albedo.b.n) return false;
+    }
+
+    return true;
+  }
+
+  /* Returns true if this describes exactly the current scene, with nothing
+   * moved since
+   */
+  bool same_scene() {
+    if (!matches_scene() || lights.count != ::lights.count) return false;
+
+    for (uint8_t i = 0; i < lights.count; i++) {
+      if (!same_vec(lights.point[i], ::lights.point[i]) ||
+          lights.intensity[i].n != ::lights.intensity[i].n) return false;
+    }
+
+    for (uint8_t i = 0; i < spheres.count; i++) {
+      if (!same_vec(sphere_point[i], spheres.point[i]) ||
+          sphere_radius[i].n != spheres.radius[i].n) return false;
+    }
+
+    return true;
+  }
+};
+
+/* Saves the finished lighting of the current scene, along with the number
+ * of updates made since it was last computed from scratch
+ */
+bool save_lighting(uint8_t updates) {
+  var_t var = open_var(light_cache_name, "w");
+  if (!var) return false;
+
+  LightCache cache;
+  cache.describe(updates);
+
+  bool ok = write_var(var, &cache, sizeof(cache));
+
+  for (uint8_t i = 0; i < planes.count && ok; i++) {
+    ok = write_var(var, plane_maps[i].bitmap, sizeof(plane_maps[i].bitmap));
+  }
+
+  archive_var(var);
+  close_var(var);
+
+  return ok;
+}
+
+/* Loads lighting saved for an earlier version of the current scene into the
+ * plane lightmaps, and describes the scene it was computed for. Returns
+ * false if there is none which can be updated
+ */
+bool load_lighting(LightCache& cache) {
+  var_t var = open_var(light_cache_name, "r");
+  if (!var) return false;
+
+  bool ok = read_var(var, &cache, sizeof(cache)) &&
+            cache.matches_scene() &&
+            cache.updates < LIGHT_CACHE_MAX_UPDATES;
+
+  for (uint8_t i = 0; i < planes.count && ok; i++) {
+    ok = read_var(var, plane_maps[i].bitmap, sizeof(plane_maps[i].bitmap));
+  }
+
+  close_var(var);
+
+  return ok;
+}
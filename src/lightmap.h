@@ -1,8 +1,13 @@
 #pragma once
 
-/* A data structure used to store radiance emitted by a scene surface at a 
- * few select sample points. These maps are primarily used for radiosity
- * calculations
+/* A data structure used to store light at a scene surface at a few select
+ * sample points. These maps are primarily used for radiosity calculations
+ *
+ * The bitmap used for rendering holds irradiance, the light arriving at the
+ * surface before it is colored by the albedo. Shading then multiplies it by
+ * the flat albedo or a texture sample directly, the same as direct lighting.
+ * Radiosity bounces the light leaving each patch, so emissive holds radiance,
+ * which already includes the albedo
  */
 
 #include <stdlib.h>
@@ -20,31 +25,13 @@
 const Fixed24 halfstep_size(1.0f / MAP_SIZE);
 const Fixed24 step_size(2.0f / MAP_SIZE);
 
-// Lookup tables for sphere sample positions
-int24_t sphere_x[8] {3784, 1567, -1567, -3784, -3784, -1567,  1567,  3784};
-int24_t sphere_y[8] {1567, 3784,  3784,  1567, -1567, -3784, -3784, -1567};
-
-int24_t sphere_elev[8]{-4017, -3405, -2275, -799,  799, 2275, 3405, 4017};
-int24_t  sphere_rad[8]{  799,  2275,  3405, 4017, 4017, 3405, 2275,  799};
-
 struct LightMap {
-  // Map of total emission for rendering
+  // Map of total indirect irradiance for rendering
   Spectrum bitmap[MAP_SIZE][MAP_SIZE];
 
   // Bitmaps that hold temporary emission for radiosity calculation
   Spectrum emissive[MAP_SIZE][MAP_SIZE];  // Outgoing radiance
-  Spectrum emissive2[MAP_SIZE][MAP_SIZE]; // Incoming radiance
-
-  /* Convert from spectral color to bitmap color
-   */
-  void toTexture(Texture &texture) {
-    for (uint8_t y = 0; y < MAP_SIZE; y++) {
-      for (uint8_t x = 0; x < MAP_SIZE; x++) {
-        Color24 error(0, 0, 0);
-        texture.bitmap[x][y] = bitmap[x][y].toColor24().toColor16(error);
-      }
-    }
-  }
+  Spectrum emissive2[MAP_SIZE][MAP_SIZE]; // Incoming irradiance
 
   /* Sets all entries in the bitmap lightmap to zero
    */
@@ -56,101 +43,89 @@ struct LightMap {
     }
   }
 
-  /* Adds collected emission from emissive2 to the bitmap, and replaces
-   * emissive with the reflected light
+  /* Adds collected irradiance from emissive2 to the bitmap, and replaces
+   * emissive with the light reflected by a surface with the given albedo
    */
-  void copy() {
+  void copy(Spectrum albedo) {
     for (uint8_t y = 0; y < MAP_SIZE; y++) {
       for (uint8_t x = 0; x < MAP_SIZE; x++) {
         // Add this round's illumination to the total illumination
         bitmap[x][y] += emissive2[x][y];
-        emissive[x][y] = emissive2[x][y];
+        emissive[x][y] = emissive2[x][y] * albedo;
       }
     }
   }
 
-  /* Copy the bitmap illumination into the emissive to compute sphere radiosity
+  /* Keeps a copy of the emitted light in emissive2, so it can be compared
+   * against after emissive is recomputed
    */
-  void from_bitmap() {
+  void keep_emissive() {
     for (uint8_t y = 0; y < MAP_SIZE; y++) {
       for (uint8_t x = 0; x < MAP_SIZE; x++) {
-        emissive[x][y] = bitmap[x][y];
+        emissive2[x][y] = emissive[x][y];
       }
     }
   }
 
-
-  /* Samples the texture on a plane with origin at (0, 0, 0)
+  /* Replaces the emitted light with how much it has changed since
+   * keep_emissive was called
    */
-  Spectrum sample(Vec3& hit_pos, Vec3& normal) {
-    // Compute the texture color at this floor position
-    int24_t tile_x = hit_pos.x.floor(LERP_BITS + MAP_BITS - 1) - LERP_HALF;
-    int24_t tile_y = hit_pos.y.floor(LERP_BITS + MAP_BITS - 1) - LERP_HALF;
-    int24_t tile_z = hit_pos.z.floor(LERP_BITS + MAP_BITS - 1) - LERP_HALF;
-
-    int24_t tex_x = 0;
-    int24_t tex_y = 0;
-    int8_t sub_x = 0;
-    int8_t sub_y = 0;
-
-    if (normal.x.n) {
-      tex_x = (tile_z >> LERP_BITS);
-      tex_y = (tile_y >> LERP_BITS);
-
-      sub_x = tile_z & LERP_MASK;
-      sub_y = tile_y & LERP_MASK;
+  void emissive_delta() {
+    for (uint8_t y = 0; y < MAP_SIZE; y++) {
+      for (uint8_t x = 0; x < MAP_SIZE; x++) {
+        emissive[x][y].r.n -= emissive2[x][y].r.n;
+        emissive[x][y].g.n -= emissive2[x][y].g.n;
+        emissive[x][y].b.n -= emissive2[x][y].b.n;
+      }
     }
+  }
 
-    if (normal.y.n) {
-      tex_x = (tile_x >> LERP_BITS);
-      tex_y = (tile_z >> LERP_BITS);
+  /* Stops patches emitting light when every channel is smaller in magnitude
+   * than the threshold. Returns true if any patch is still emitting
+   */
+  bool drop_below(Fixed24 threshold) {
+    bool emitting = false;
 
-      sub_x = tile_x & LERP_MASK;
-      sub_y = tile_z & LERP_MASK;
+    for (uint8_t y = 0; y < MAP_SIZE; y++) {
+      for (uint8_t x = 0; x < MAP_SIZE; x++) {
+        Spectrum& s = emissive[x][y];
+
+        if (abs(s.r.n) < threshold.n && abs(s.g.n) < threshold.n &&
+            abs(s.b.n) < threshold.n) {
+          s = Spectrum();
+        }
+        else {
+          emitting = true;
+        }
+      }
     }
 
-    if (normal.z.n) {
-      tex_x = (tile_x >> LERP_BITS);
-      tex_y = (tile_y >> LERP_BITS);
+    return emitting;
+  }
 
-      sub_x = tile_x & LERP_MASK;
-      sub_y = tile_y & LERP_MASK;
+  /* Copy the light reflected from the bitmap illumination into the emissive
+   * to compute sphere radiosity
+   */
+  void from_bitmap(Spectrum albedo) {
+    for (uint8_t y = 0; y < MAP_SIZE; y++) {
+      for (uint8_t x = 0; x < MAP_SIZE; x++) {
+        emissive[x][y] = bitmap[x][y] * albedo;
+      }
     }
-
-    int16_t tex_x0 = tex_x;
-    int16_t tex_x1 = (tex_x + 1);
-    int16_t tex_y0 = tex_y;
-    int16_t tex_y1 = (tex_y + 1);
-
-    tex_x0 = tex_x0 < 0 ? 0 : tex_x0;
-    tex_x1 = tex_x1 > MAP_MASK ? MAP_MASK : tex_x1;
-    tex_y0 = tex_y0 < 0 ? 0 : tex_y0;
-    tex_y1 = tex_y1 > MAP_MASK ? MAP_MASK : tex_y1;
-
-    Spectrum tex00 = bitmap[tex_x0][tex_y0];
-    Spectrum tex10 = bitmap[tex_x1][tex_y0];
-    Spectrum tex01 = bitmap[tex_x0][tex_y1];
-    Spectrum tex11 = bitmap[tex_x1][tex_y1];
-
-    return bilinear(tex00, tex10, tex01, tex11, sub_x, sub_y);
   }
 
-  /* Samples the texture on a sphere with origin (0, 0, 0)
-   */
-  Spectrum sample(Vec3& normal) {
-    // Compute the spherical coordinates of this normal
-    Fixed24 theta = atan2(normal.x, normal.z);
-    Fixed24   phi = (Fixed24(1) + asin(normal.y)); \
 
-    // Compute the texture index of this point
-    int24_t tile_x = theta.floor(LERP_BITS + MAP_BITS - 1) - LERP_HALF;
-    int24_t tile_y = phi.floor(LERP_BITS + MAP_BITS - 1) - LERP_HALF;
+  /* Samples the texture on a plane at texture coordinates (u, v), measured
+   * from the plane origin
+   */
+  Spectrum sample(Fixed24 u, Fixed24 v) {
+    // Compute the texture color at this position
+    int24_t tile_x = u.floor(LERP_BITS + MAP_BITS - 1) - LERP_HALF;
+    int24_t tile_y = v.floor(LERP_BITS + MAP_BITS - 1) - LERP_HALF;
 
-    // Compute the texel coordinates
-    int8_t tex_x = tile_x >> LERP_BITS;
-    int8_t tex_y = tile_y >> LERP_BITS;
+    int24_t tex_x = (tile_x >> LERP_BITS);
+    int24_t tex_y = (tile_y >> LERP_BITS);
 
-    // Get the subpixel index
     int8_t sub_x = tile_x & LERP_MASK;
     int8_t sub_y = tile_y & LERP_MASK;
 
@@ -173,67 +148,19 @@ struct LightMap {
   }
 };
 
-/* Given a plane origin and normal, computes the world space coordinates
- * for the given texture pixel coordinates.
+/* Given a plane origin and the axes its texture coordinates run along,
+ * computes the world space coordinates for the given texture pixel
+ * coordinates.
  *
  * This implementation only works for axis-aligned planes
  */
-Vec3 get_sample_pos(Vec3 &point, Vec3 &normal, uint8_t x, uint8_t y) {
-  Vec3 step_x;
-  Vec3 step_y;
-  
-  // Determine which direction each sample point moves as we increment the x 
-  // and y coordinates in the texture
-  if (normal.x.n != 0) {
-    step_x = Vec3(Fixed24(0), Fixed24(0), step_size);
-    step_y = Vec3(Fixed24(0), step_size, Fixed24(0));
-  }
-
-  if (normal.y.n != 0) {
-    step_x = Vec3(step_size, Fixed24(0), Fixed24(0));
-    step_y = Vec3(Fixed24(0), Fixed24(0), step_size);
-  }
+Vec3 get_sample_pos(Vec3 &point, uint8_t u_axis, uint8_t v_axis, uint8_t x, uint8_t y) {
+  // Move the sample origin half a sample step from the real origin, then
+  // step along each texture axis
+  Vec3 out = point;
 
-  if (normal.z.n != 0) {
-    step_x = Vec3(step_size, Fixed24(0), Fixed24(0));
-    step_y = Vec3(Fixed24(0), step_size, Fixed24(0));
-  }
-
-
-  // Move the sample origin half a sample step from the real origin
-  Vec3 out = point + (step_x + step_y) * Fixed24(.5f);
-
-  for (int8_t i = 0; i < x; i++) {
-    out += step_x;
-  }
-
-  for (int8_t i = 0; i < y; i++) {
-    out += step_y;
-  }
+  out[u_axis] += halfstep_size + step_size * Fixed24((int24_t)x);
+  out[v_axis] += halfstep_size + step_size * Fixed24((int24_t)y);
 
   return out;
-
-
 }
-
-/* Given a unit sphere centered about the origin, computes the world space 
- * coordinates for the given texture pixel coordinates.
- */
-Vec3 get_sample_pos(uint8_t x, uint8_t y) {
-  Vec3 out;
-
-  // Get the sphere elevation and radius at this elevation
-  Fixed24 scl;
-  out.y.n = sphere_elev[y];
-  scl.n = sphere_rad[y];
-
-  // Compute the point in the horizontal plane
-  out.x.n = sphere_x[x];
-  out.z.n = sphere_y[x];
-
-  // Scale this point to the unit sphere
-  out.x = out.x * scl;
-  out.z = out.z * scl;
-
-  return out;
-}
\ No newline at end of file
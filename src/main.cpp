@@ -5,6 +5,7 @@
 
 #include "fixedpoint.h"
 #include "vector.h"
+#include "fixed16.h"
 #include "ray.h"
 #include "plane.h"
 #include "sphere.h"
@@ -15,279 +16,401 @@
 #include "lightmap.h"
 #include "scene.h"
 #include "radiosity.h"
-
+#include "region.h"
+#include "sceneFile.h"
+#include "renderConfig.h"
+#include "profiler.h"
+#include "verify.h"
+#include "palette.h"
+#include "visibility.h"
+#include "shading.h"
+
+#ifdef __TICE__
 // The base pointer for VRAM
 volatile Color* VRAM = (Color*)0xD40000;
+#else
+// Elsewhere there is no screen, so the render is kept in memory, for example
+// to be verified against a golden image
+Color host_screen[LCD_WIDTH * LCD_HEIGHT];
+volatile Color* VRAM = host_screen;
+#endif
+
+// The framebuffer being rendered to. In palette mode this is the hidden
+// graphx buffer once the display has been started
+volatile Pixel* frame = (Pixel*)VRAM;
 
 Ray ray;
-Vec3 hit_pos;
-
-// Grain controls the granularity of the output render
-// For full resolution, each pixel is a 1x1 square, although
-// higher granularity can speed up render time
-const uint8_t grain = 1;
-// Supersampling allows for rendering of a scene at a resolution
-// higher than the display hardware allows by rendering rectangular
-// sections of pixels which fill the screen. This line will enable
-// 2x2 supersampling for an output image with resolution 640 x 480
-//const uint8_t supersample = 2;
-const uint8_t supersample = 1;
+
 
 const int24_t mid_x = LCD_WIDTH / 2;
 const int24_t mid_y = LCD_HEIGHT / 2;
 
-Vec3 cam_origin(0, 0, 0);
 const Fixed24 cam_scl(1.0f / LCD_HEIGHT);
 
-Fixed24 exposure(2.0f);
-
 // Position to set the view ray along each axis when starting a new row or
 // column of our raster scan
 Fixed24 left;
 Fixed24 top;
 
-// The offset from the VRAM base of the pixel we are currently computing
+// The AppVar holding the scene to render
+const char* scene_name = "RTSCENE";
+
+// The offset from the framebuffer base of the pixel we are currently computing
 uint24_t pixelOff = 0;
 
+// Samples of a row rendered in checkerboard mode, along with the surface
+// each one saw
+struct CheckerRow {
+  Color24 color[LCD_WIDTH];
+  uint16_t id[LCD_WIDTH];
+};
+
+// The row being rendered in checkerboard mode and the one above it, which
+// is only valid if it was the last row rendered with the same horizontal
+// extent
+CheckerRow checker_rows[2];
+uint8_t checker_current = 0;
+int24_t checker_y = -1;
+int24_t checker_x0 = 0;
+int24_t checker_x1 = 0;
+
 /* Initializes scene variables, and registers the camera with all scene objects
+ *
+ * Lighting resumes from a saved checkpoint if there is one. Otherwise it is
+ * updated from the lighting of the last scene rendered, if that differs only
+ * by the light and sphere positions. Returns false if interrupted before
+ * lighting has been computed
  */
-void scene_init() {
-  // A few altername scene parameters which can be substituted in for
-  // different scene configurations
-  //light.x = Fixed24( 0.5f);
-  //light.z = Fixed24( 3.5f);
-  //light.y = Fixed24(-0.9f);
+bool scene_init() {
+  // Find the textures in their AppVars before the scene refers to them
+  load_textures();
+
+  // Load the scene file if one has been provided, otherwise fall back to
+  // the built in scene
+  if (!load_scene(scene_name)) {
+    default_scene();
+  }
+
+  room.build(planes);
 
-  light.x = Fixed24( 0.0f);
-  light.z = Fixed24( 3.0f);
-  light.y = Fixed24( 0.5f);
+  // Lighting initialization
+  if (!load_checkpoint() && !warm_start()) {
+    compute_illumination();
+  }
 
-  //cam_origin.x = Fixed24(-0.5f);
-  //cam_origin.y = Fixed24(-0.5f);
-  //cam_origin.z = Fixed24( 1.5f);
+  bool lit = progress.stage == STAGE_RENDER;
 
+  if (!compute_radiosity()) return false;
 
-  spheres[0].point.x = Fixed24(-.33f);
-  spheres[0].point.y = Fixed24(-.8f);
-  spheres[0].point.z = Fixed24(3.052f);
-  
-  spheres[1].point.x = Fixed24(.43f);
-  spheres[1].point.y = Fixed24(-.8f);
-  spheres[1].point.z = Fixed24(2.43f);
+  // Save the finished lighting right away, so it isn't lost if the calculator
+  // loses power while rendering
+  if (!lit) {
+    save_checkpoint(frame);
+    save_lighting(progress.updates);
 
-  spheres[0].point.y = Fixed24(-.6f);
-  spheres[1].point.y = Fixed24(-.6f);
+    // Archiving can move the textures in flash, so find them again. The
+    // materials point at the same Texture, so they need not be reloaded
+    load_textures();
+  }
 
-  // Lighting initialization
-  compute_illumination();
-  compute_radiosity();
+  // Find which lights reach each part of the planes, so shading can skip
+  // most shadow rays
+  visibility.compute_all();
 
-  left = Fixed24(-mid_x - grain) * cam_scl;
-  top  = Fixed24( mid_y - grain) * cam_scl;
+  left = Fixed24(-mid_x - RenderConfig::grain) * cam_scl;
+  top  = Fixed24( mid_y - RenderConfig::grain) * cam_scl;
 
   // Register all scene objects with the camera
-  for (Plane& obj : sceneObjs) {
-    obj.register_camera(cam_origin);
+  for (uint8_t i = 0; i < planes.count; i++) {
+    planes.register_camera(i, cam_origin);
   }
 
-  for (Sphere& obj : spheres) {
-    obj.register_camera(cam_origin);
+  for (uint8_t i = 0; i < spheres.count; i++) {
+    spheres.register_camera(i, cam_origin);
   }
-}
 
-Spectrum compute_ray(Ray& ray, bool from_cam);
+  return true;
+}
 
-/* Given a ray and hit information, computes the shading of the provided
- * object at the hit point
+/* Converts a pixel color to 16-bit color using the dithering mode of the
+ * render configuration. Error carries rounding error along the current row,
+ * and (x, y) is the position of the sample on screen, in samples
+ *
+ * In palette mode this looks up a palette entry instead, always with ordered
+ * dithering since the palette entries are not evenly spaced
  */
-Spectrum compute_shading(Ray& ray, Vec3 &hit_pos, SceneObj &obj) {
-  Vec3 normal;
-  Vec3 shadowDir = light - hit_pos;
-  Vec3 offset = light - hit_pos;
-  Ray shadow_ray(hit_pos, offset);
-  Vec3 sample_pos;
-  Spectrum color;
-  
-  switch (obj.type) {
-  case PLANE:
-    normal = obj.plane->normal;
+template <class Config>
+Pixel quantize(Color24 color24, Color24& error, int24_t x, int24_t y) {
+#ifdef PALETTE
+  (void)error;
+  return palette.index(color24, dither_threshold(x, y));
+#else
+  if (Config::dither == DITHER_ERROR_DIFFUSION) {
+    color24 += error;
+
+    return color24.toColor16(error);
+  }
 
-    // Otherwise sample the texture with respect to the plane origin
-    sample_pos = hit_pos - obj.plane->point;
-    color = obj.plane->light_map.sample(sample_pos, obj.plane->normal);
+  if (Config::dither == DITHER_ORDERED) {
+    return color24.toColor16(dither_threshold(x, y));
+  }
 
-    if (!compute_shadow(shadow_ray)) {
-      // Compute the lambertian attenuation of the lighting at this sample point
-      Fixed24 attenuation = dot(normal, offset);
+  return color24.toColor16();
+#endif
+}
 
-      attenuation = clamp01(div(attenuation, offset.norm() * offset.norm_squared()));
+/* Lets camera rays test every sphere wherever they are on screen
+ */
+void clear_spans() {
+  for (uint8_t i = 0; i < spheres.count; i++) {
+    span_start[i] = 0;
+    span_end[i] = LCD_WIDTH;
+  }
+}
 
-      Spectrum albedo = obj.plane->albedo;
+/* Finds the columns each sphere may cover on a row of camera rays with the
+ * given y direction, where the ray in column x has an x direction of
+ * left + (x / grain + 1) * step
+ */
+void compute_spans(Fixed24 dir_y, Fixed24 step, uint8_t grain) {
+  for (uint8_t i = 0; i < spheres.count; i++) {
+    float lo, hi;
+
+    if (!spheres.camera_span(i, dir_y, lo, hi)) {
+      span_start[i] = 0;
+      span_end[i] = LCD_WIDTH;
+      continue;
+    }
 
-      albedo.r = albedo.r * attenuation;
-      albedo.g = albedo.g * attenuation;
-      albedo.b = albedo.b * attenuation;
+    // Convert the directions to ray indices along the row, padded by one ray
+    // on either side
+    float scale = (1 << POINT) / (float)step.n;
+    float first = (lo - left.n / (float)(1 << POINT)) * scale - 2;
+    float last  = (hi - left.n / (float)(1 << POINT)) * scale;
 
-      color += albedo;
+    if (first > last || last < 0 || first > LCD_WIDTH) {
+      span_start[i] = span_end[i] = 0;
+      continue;
     }
 
-    // If this object has a texture
-    if (obj.plane->texture != nullptr) {
-      // Remove the flat albedo
-      color.r = div(color.r, obj.plane->albedo.r);
-      color.g = div(color.g, obj.plane->albedo.g);
-      color.b = div(color.b, obj.plane->albedo.b);
+    if (first < 0) first = 0;
+    if (last > LCD_WIDTH) last = LCD_WIDTH;
+
+    span_start[i] = (int24_t)floor(first) * grain;
+    span_end[i] = ((int24_t)ceil(last) + 1) * grain;
+  }
+}
 
-      // Sample the precise albedo from the texture, and apply that one
-      Spectrum tex_color(obj.plane->texture->sample(sample_pos, obj.plane->normal));
+/*  Renders the scene in segments, each of which will the screen
+ *
+ * Rendering resumes from the segment and row stored in progress, and the 
+ * keyboard is polled between rows. Returns false if interrupted
+ */
+template <class Config>
+bool render_supersample() {
+  const uint8_t supersample = Config::supersample;
 
-      color.r = color.r * tex_color.r;
-      color.g = color.g * tex_color.g;
-      color.b = color.b * tex_color.b;
-    }
+  ray.origin = cam_origin;
+
+  clear_spans();
+
+  for (; progress.segment < supersample * supersample; progress.segment++) {
+    int24_t sy = (progress.segment / supersample) * LCD_HEIGHT;
+    int24_t sx = (progress.segment % supersample) * LCD_WIDTH;
+
+    //Compute the camera ray for every pixel
+    ray.dir.z = Fixed24(1);
+    for (; progress.y < LCD_HEIGHT; progress.y++) {
+      if (interrupted()) return false;
 
-    return color;
+      int24_t y = progress.y;
+      pixelOff = LCD_WIDTH * y;
 
-  case SPHERE:
-    normal = hit_pos - obj.sphere->point;
-    normal.x = div(normal.x, obj.sphere->radius);
-    normal.y = div(normal.y, obj.sphere->radius);
-    normal.z = div(normal.z, obj.sphere->radius);
+      // Accumulate error over each row
+      Color24 error(0, 0, 0);
 
-    if (obj.sphere->reflective) {
-      Vec3 reflection = ray.dir - (normal * (Fixed24(2) * dot(ray.dir, normal)));
+      for (int24_t x = 0; x < LCD_WIDTH; x++) {
+        // Increment the ray direction for each pixel we consider
+        ray.dir.y = top  - (Fixed24(sy + y) * cam_scl * Fixed24(1.0f / supersample));
+        ray.dir.x = left + (Fixed24(sx + x) * cam_scl * Fixed24(1.0f / supersample));
 
+        Spectrum spectrum = compute_ray<Config, true>(ray);
 
-      Ray reflect_ray(hit_pos + (reflection * Fixed24(0.01f)), reflection);
+        PROFILE_BEGIN(PROF_GAMMA);
+        Color24 color24 = spectrum.toColor24();
+        PROFILE_END(PROF_GAMMA);
 
-      return compute_ray(reflect_ray, false);
+        PROFILE_BEGIN(PROF_DITHER);
+        frame[pixelOff++] = quantize<Config>(color24, error, x, y);
+        PROFILE_END(PROF_DITHER);
+      }
     }
 
-    color = obj.sphere->light_map.sample(normal);
+    progress.y = 0;
+  }
+
+  return true;
+}
 
-    // Compute the lambertian attenuation of the lighting at this sample point
-    Fixed24 attenuation = dot(normal, shadowDir);
+/* Traces the sample at index s along the current row into a checkerboard
+ * row, recording the surface it saw
+ */
+template <class Config>
+void trace_sample(CheckerRow& row, int24_t s, Fixed24 step) {
+  ray.dir.x = left + (Fixed24(s + 1) * step);
+  ray_column = s * Config::grain;
 
-    attenuation = clamp01(div(attenuation, shadowDir.norm() * shadowDir.norm_squared()));
+  Spectrum spectrum = compute_ray<Config, true>(ray);
 
-    color += Spectrum(attenuation);
+  PROFILE_BEGIN(PROF_GAMMA);
+  row.color[s] = spectrum.toColor24();
+  PROFILE_END(PROF_GAMMA);
 
-    return color;
-  }
-  
+  row.id[s] = hit_id;
 }
 
-/* Computes the scene color for a given ray
+/* Fills in the samples of one row of a region for checkerboard rendering,
+ * with the ray direction already set for the row
+ *
+ * Every other sample is traced, alternating between rows. Each remaining
+ * sample is the average of its left, right and upper neighbours if at least
+ * two of them are available and all saw the same surface. Otherwise it lies
+ * on the edge of an object, a shadow or a reflection, and is traced as well
+ *
+ * The upper neighbour is only available when the row above was the last one
+ * rendered, so the first row of a region, or of a resumed render, is
+ * reconstructed from the left and right neighbours alone
  */
-Spectrum compute_ray(Ray &ray, bool from_cam) {
-  Spectrum color(Fixed24(0));
+template <class Config>
+void render_checkerboard(const Region& region, int24_t y, Fixed24 step) {
+  const uint8_t grain = Config::grain;
+  const int24_t first = region.x0 / grain;
+  const int24_t end = (region.x1 + grain - 1) / grain;
 
-  
-  // Start the culling depth at 2000 units (practically infinity for FP24)
-  Fixed24 min_t(2000);
-  SceneObj closestObj;
-
-  // Find the closest hit along our ray
-  for (Plane& obj : sceneObjs) {
-    Fixed24 t = from_cam ? obj.ray_intersect_fast(ray) : obj.ray_intersect(ray);
-
-    // If we hit closer to the camera, keep this depth
-    if (t.n > 1 && t < min_t) {
-      closestObj = SceneObj(&obj);
-      min_t = t;
-    }
-  }
+  bool has_above = checker_y == y - grain &&
+                   checker_x0 == region.x0 && checker_x1 == region.x1;
 
-  // Check if we hit any spheres
-  for (Sphere& obj : spheres) {
-    Fixed24 t = from_cam ? obj.ray_intersect_fast(ray) : obj.ray_intersect(ray);
+  CheckerRow& above = checker_rows[checker_current];
+  checker_current ^= 1;
+  CheckerRow& row = checker_rows[checker_current];
 
-    // If we hit closer to the camera, keep this depth
-    if (t.n > 1 && t < min_t) {
-      closestObj = SceneObj(&obj);
-      min_t = t;
-    }
-  }
+  checker_y = y;
+  checker_x0 = region.x0;
+  checker_x1 = region.x1;
 
-  // If we hit an object, compute the color of that object
-  if (min_t < Fixed24(2000)) {
-    hit_pos = ray.at(min_t);
-    color = compute_shading(ray, hit_pos, closestObj);
+  // The first sample of the row which is always traced
+  int24_t start = first + ((first + y / grain) & 1);
+
+  for (int24_t s = start; s < end; s += 2) {
+    trace_sample<Config>(row, s, step);
   }
 
-  color.r = color.r * exposure;
-  color.g = color.g * exposure;
-  color.b = color.b * exposure;
+  for (int24_t s = start == first ? first + 1 : first; s < end; s += 2) {
+    Color24 neighbours[3];
+    uint16_t ids[3];
+    uint8_t count = 0;
 
-  return color;
-}
+    if (s > first) {
+      neighbours[count] = row.color[s - 1];
+      ids[count++] = row.id[s - 1];
+    }
 
-/*  Renders the scene in segments, each of which will the screen
- */
-void render_supersample() {
-  ray.origin = cam_origin;
+    if (s + 1 < end) {
+      neighbours[count] = row.color[s + 1];
+      ids[count++] = row.id[s + 1];
+    }
 
-  for (int24_t sy = 0; sy < supersample * LCD_HEIGHT; sy += LCD_HEIGHT) {
-    for (int24_t sx = 0; sx < supersample * LCD_WIDTH; sx += LCD_WIDTH) {
-      //Compute the camera ray for every pixel
-      ray.dir.z = Fixed24(1);
-      for (int24_t y = 0; y < LCD_HEIGHT; y++) {
-        // Accumulate error over each row
-        Color24 error(0, 0, 0);
+    if (has_above) {
+      neighbours[count] = above.color[s];
+      ids[count++] = above.id[s];
+    }
 
-        for (int24_t x = 0; x < LCD_WIDTH; x++) {
-          // Increment the ray direction for each pixel we consider
-          ray.dir.y = top  - (Fixed24(sy + y) * cam_scl * Fixed24(1.0f / supersample));
-          ray.dir.x = left + (Fixed24(sx + x) * cam_scl * Fixed24(1.0f / supersample));
+    bool same = count >= 2;
 
-          Color24 color24 = compute_ray(ray, true).toColor24();
+    for (uint8_t i = 1; i < count; i++) {
+      if (ids[i] != ids[0]) same = false;
+    }
 
-          color24 += error;
+    if (!same) {
+      trace_sample<Config>(row, s, step);
+      continue;
+    }
 
-          VRAM[pixelOff++] = color24.toColor16(error);
-        }
-      }
+    uint24_t r = 0;
+    uint24_t g = 0;
+    uint24_t b = 0;
 
-      // Reset offset to the top-left corner
-      pixelOff = 0;
+    for (uint8_t i = 0; i < count; i++) {
+      r += neighbours[i].r;
+      g += neighbours[i].g;
+      b += neighbours[i].b;
     }
+
+    row.color[s] = Color24(r / count, g / count, b / count);
+    row.id[s] = ids[0];
   }
 }
 
-/* Renders the scene at standard size (no supersampling)
+/* Renders the pixels of the scene inside the given region of the screen,
+ * leaving the rest of the framebuffer untouched
+ *
+ * Error diffusion restarts at the left edge of the region, so pixels along
+ * that edge may dither slightly differently from a full-screen render.
+ * Ordered dithering gives the same pixels in any region
  */
-void render() {
+template <class Config>
+void render_region(const Region& region) {
+  const uint8_t grain = Config::grain;
+  const Fixed24 step = cam_scl * grain;
+
   ray.origin = cam_origin;
 
   //Compute the camera ray for every pixel
   ray.dir.z = Fixed24(1);
-  ray.dir.y = top;
-  for (int24_t y = 0; y < LCD_HEIGHT; y += grain) {
-    // Increment the ray direction for each pixel we consider
-    ray.dir.y -= (cam_scl * grain);
-    ray.dir.x = left;
+  for (int24_t y = region.y0; y < region.y1; y += grain) {
+    // Position the ray direction at the start of this row
+    ray.dir.y = top  - (Fixed24(y / grain + 1) * step);
+    ray.dir.x = left + (Fixed24(region.x0 / grain) * step);
+
+    compute_spans(ray.dir.y, step, grain);
+
+    if (Config::checkerboard) {
+      render_checkerboard<Config>(region, y, step);
+    }
 
     // Accumulate error over each row
     Color24 error(0, 0, 0);
 
-    for (int24_t x = 0; x < LCD_WIDTH; x += grain) {
-      ray.dir.x += (cam_scl * grain);
+    for (int24_t x = region.x0; x < region.x1; x += grain) {
+      Color24 color24;
+
+      if (Config::checkerboard) {
+        color24 = checker_rows[checker_current].color[x / grain];
+      }
+      else {
+        ray.dir.x += step;
+        ray_column = x;
 
-      Color24 color24 = compute_ray(ray, true).toColor24();
-      
-      color24 += error;
+        Spectrum spectrum = compute_ray<Config, true>(ray);
 
-      Color color = color24.toColor16(error);
+        PROFILE_BEGIN(PROF_GAMMA);
+        color24 = spectrum.toColor24();
+        PROFILE_END(PROF_GAMMA);
+      }
+
+      PROFILE_BEGIN(PROF_DITHER);
+      Pixel color = quantize<Config>(color24, error, x / grain, y / grain);
+      PROFILE_END(PROF_DITHER);
 
-      // If we are granularity 1, just place the pixel sequentially
+      // If we are granularity 1, just place the pixel
       if (grain == 1) {
-        VRAM[pixelOff++] = color;
+        frame[x + (LCD_WIDTH * y)] = color;
       }
       // Otherwise, fill a box with the color
       else {
         for (uint8_t py = 0; py < grain; py++) {
           for (uint8_t px = 0; px < grain; px++) {
-            VRAM[(x + px) + (LCD_WIDTH * (y + py))] = color;
+            frame[(x + px) + (LCD_WIDTH * (y + py))] = color;
           }
         }
       }
@@ -295,23 +418,578 @@ void render() {
   }
 }
 
+/* Renders the scene at standard size (no supersampling)
+ *
+ * Rendering resumes from the row stored in progress, and the keyboard is 
+ * polled between rows. Returns false if interrupted
+ */
+template <class Config>
+bool render() {
+  const uint8_t grain = Config::grain;
+
+  for (; progress.y < LCD_HEIGHT; progress.y += grain) {
+    if (interrupted()) return false;
+
+    render_region<Config>(Region(0, progress.y, LCD_WIDTH, progress.y + grain));
+  }
+
+  return true;
+}
+
+#ifdef PALETTE
+// Whether graphx has taken over the display
+bool display_started = false;
+
+/* Builds the palette from a histogram of the colors in a coarse render of
+ * the scene, which is traced but never displayed
+ */
+template <class Config>
+void build_palette() {
+  const uint8_t grain = PALETTE_SAMPLE_GRAIN;
+  const Fixed24 step = cam_scl * grain;
+
+  uint16_t* histogram = (uint16_t*)calloc(PALETTE_CELLS, sizeof(uint16_t));
+
+  if (!histogram) {
+    palette.build_default();
+    return;
+  }
+
+  ray.origin = cam_origin;
+
+  ray.dir.z = Fixed24(1);
+  for (int24_t y = 0; y < LCD_HEIGHT; y += grain) {
+    ray.dir.y = top - (Fixed24(y / grain + 1) * step);
+    ray.dir.x = left;
+
+    compute_spans(ray.dir.y, step, grain);
+
+    for (int24_t x = 0; x < LCD_WIDTH; x += grain) {
+      ray.dir.x += step;
+      ray_column = x;
+
+      Color24 color24 = compute_ray<Config, true>(ray).toColor24();
+      uint16_t& count = histogram[palette_cell(color24)];
+
+      if (count < UINT16_MAX) count++;
+    }
+  }
+
+  palette.build(histogram);
+
+  free(histogram);
+}
+#endif
+
+/* Prepares the display for rendering. In palette mode this builds the
+ * palette, switches to 8bpp and directs rendering to the hidden buffer.
+ * Must be called after lighting, since the homescreen is used until then
+ */
+template <class Config>
+void start_display() {
+#ifdef PALETTE
+  build_palette<Config>();
+
+  gfx_Begin();
+  display_started = true;
+
+  gfx_SetPalette(palette.colors, sizeof(palette.colors), 0);
+  gfx_SetDrawBuffer();
+
+  frame = &gfx_vbuffer[0][0];
+#endif
+}
+
+/* Shows the finished framebuffer. In palette mode this swaps the hidden
+ * buffer onto the screen, then copies it back so the new hidden buffer
+ * starts from the same image for later partial re-renders
+ */
+void show_frame() {
+#ifdef PALETTE
+  gfx_SwapDraw();
+  gfx_Blit(gfx_screen);
+
+  frame = &gfx_vbuffer[0][0];
+#endif
+}
+
+/* Returns the display to the OS, if it was started
+ */
+void end_display() {
+#ifdef PALETTE
+  if (display_started) gfx_End();
+#endif
+}
+
+/* Expands a region to cover the screen position of a world space point
+ *
+ * Points behind or close to the camera would project further out than 12.12
+ * values can hold, so in that case the whole screen is added to the region.
+ * Points far off to the side are moved in to 4 times their depth, which is
+ * still off the same edge of the screen, for the same reason
+ */
+void add_projection(Region& region, Vec3 point) {
+  Vec3 rel = point - cam_origin;
+
+  if (rel.z < Fixed24(0.25f)) {
+    region.add(full_screen);
+    return;
+  }
+
+  Fixed24 limit = rel.z * Fixed24(4);
+
+  if (rel.x > limit) rel.x = limit;
+  if (rel.y > limit) rel.y = limit;
+  if (rel.x < -limit) rel.x = -limit;
+  if (rel.y < -limit) rel.y = -limit;
+
+  // Invert the camera ray computation in render_region
+  Fixed24 scl = rel.z * cam_scl;
+
+  int24_t x = div(rel.x, scl).floor() + mid_x;
+  int24_t y = mid_y - div(rel.y, scl).floor();
+
+  region.add(x, y);
+}
+
+/* Computes the screen region covered by a sphere by projecting the corners of
+ * its bounding box
+ */
+Region sphere_bounds(uint8_t index) {
+  Fixed24 radius = spheres.radius[index];
+
+  Region region;
+
+  for (uint8_t i = 0; i < 8; i++) {
+    Vec3 corner = spheres.point[index];
+
+    corner.x += (i & 1) ? radius : -radius;
+    corner.y += (i & 2) ? radius : -radius;
+    corner.z += (i & 4) ? radius : -radius;
+
+    add_projection(region, corner);
+  }
+
+  return region;
+}
+
+/* Computes the screen region covered by the shadow a sphere casts onto the
+ * scene planes from the light at the given position.
+ *
+ * The edge of the shadow is traced by casting rays from the light along the
+ * cone which just encloses the sphere, and the region covers wherever these
+ * rays land
+ */
+Region shadow_bounds(uint8_t index, Vec3& light) {
+  const uint8_t samples = 16;
+
+  Region region;
+
+  // Find the extent of the scene
+  Vec3 scene_min = planes.point[0];
+  Vec3 scene_max = planes.point[0];
+
+  for (uint8_t i = 0; i < planes.count; i++) {
+    Vec3& point = planes.point[i];
+    if (point.x < scene_min.x) scene_min.x = point.x;
+    if (point.y < scene_min.y) scene_min.y = point.y;
+    if (point.z < scene_min.z) scene_min.z = point.z;
+    if (point.x > scene_max.x) scene_max.x = point.x;
+    if (point.y > scene_max.y) scene_max.y = point.y;
+    if (point.z > scene_max.z) scene_max.z = point.z;
+  }
+
+  Vec3 center = spheres.point[index];
+  Fixed24 radius = spheres.radius[index];
+
+  Vec3 axis = center - light;
+  Fixed24 dist2 = axis.norm_squared();
+  Fixed24 radius2 = sqr(radius);
+
+  // The light is inside the sphere, so everything is in shadow
+  if (dist2 <= radius2) return full_screen;
+
+  // Build two unit vectors perpendicular to the cone axis
+  Vec3 u = cross(axis, abs(axis.y.n) > abs(axis.x.n) ? Vec3(1, 0, 0) 
+                                                      : Vec3(0, 1, 0));
+  Vec3 v = cross(axis, u);
+
+  Fixed24 u_len = u.norm();
+  Fixed24 v_len = v.norm();
+
+  // Offsetting the sphere center by this distance lands on the cone tangent 
+  // to the sphere, with a small margin for rounding
+  Fixed24 diff = dist2 - radius2;
+  Fixed24 spread = div(radius * sqrt(dist2), sqrt(diff)) * Fixed24(1.05f);
+
+  u = u * div(spread, u_len);
+  v = v * div(spread, v_len);
+
+  // Part of the shadow may leave through the open side of the scene facing
+  // the camera. Where it does, the visible shadow is bounded by the edges of
+  // that opening, so we also track where the edge rays cross it
+  Region opening;
+  bool escaped = false;
+
+  for (uint8_t i = 0; i < samples; i++) {
+    float angle = i * (2.0f * (float)M_PI / samples);
+
+    Vec3 edge = center + u * Fixed24(cosf(angle)) + v * Fixed24(sinf(angle));
+
+    Ray shadow_ray(light, edge - light);
+
+    // Find where this edge of the shadow lands
+    Fixed24 min_t(2000);
+
+    if (room.active) {
+      uint8_t j;
+      Fixed24 t = room.ray_intersect(shadow_ray, j);
+
+      if (t.n > 1) min_t = t;
+    }
+    else {
+      for (uint8_t j = 0; j < planes.count; j++) {
+        Fixed24 t = planes.ray_intersect(j, shadow_ray);
+
+        if (t.n > 1 && t < min_t) min_t = t;
+      }
+    }
+
+    if (min_t < Fixed24(2000)) {
+      add_projection(region, shadow_ray.at(min_t));
+    }
+    else {
+      escaped = true;
+    }
+
+    // Rays heading away from the opening can never cross it
+    if (shadow_ray.dir.z.n >= 0) {
+      opening = full_screen;
+      continue;
+    }
+
+    Fixed24 t = div(scene_min.z - light.z, shadow_ray.dir.z);
+
+    // Rays nearly parallel to the opening cross it too far away to represent
+    if (t > Fixed24(100)) {
+      opening = full_screen;
+      continue;
+    }
+
+    Vec3 crossing = shadow_ray.at(t);
+
+    crossing.x = crossing.x < scene_min.x ? scene_min.x : crossing.x;
+    crossing.x = crossing.x > scene_max.x ? scene_max.x : crossing.x;
+    crossing.y = crossing.y < scene_min.y ? scene_min.y : crossing.y;
+    crossing.y = crossing.y > scene_max.y ? scene_max.y : crossing.y;
+    crossing.z = scene_min.z;
+
+    add_projection(opening, crossing);
+  }
+
+  if (escaped) {
+    region.add(opening);
+  }
+
+  return region;
+}
+
+/* Computes every part of the screen which could change when the given sphere
+ * is moved, excluding its previous position
+ */
+Region sphere_footprint(uint8_t index) {
+  Region region = sphere_bounds(index);
+
+  for (uint8_t l = 0; l < lights.count; l++) {
+    region.add(shadow_bounds(index, lights.point[l]));
+  }
+
+  // Any change in the scene can show up in a mirror
+  for (uint8_t i = 0; i < spheres.count; i++) {
+    if (RenderConfig::reflections && sphere_materials[i].reflective) {
+      region.add(sphere_bounds(i));
+    }
+  }
+
+  return region;
+}
+
+/* Moves a sphere to a new position, and returns the parts of the screen
+ * which could have changed. This includes the old and new positions of the
+ * sphere, its shadow, and any reflective spheres it appears in
+ */
+Region update_sphere(uint8_t index, Vec3 point) {
+  Region region = sphere_footprint(index);
+
+  spheres.point[index] = point;
+  spheres.register_camera(index, cam_origin);
+  visibility.compute_all();
+
+  region.add(sphere_footprint(index));
+
+  // Leave a small border to account for rounding in the projection and 
+  // the spacing between samples along the edge of the shadow. Each block of
+  // grain x grain pixels shows the sample at its bottom right corner, so
+  // changes can also show up to a block above and to the left
+  region.pad(4 + RenderConfig::grain);
+  region.clip(RenderConfig::grain);
+
+  return region;
+}
+
+/* Moves a sphere to a new position and re-renders only the parts of the 
+ * screen which could have changed
+ *
+ * Lightmaps are not recomputed, so indirect lighting will still reflect the
+ * old position of the sphere
+ */
+void move_sphere(uint8_t index, Vec3 point) {
+  render_region<RenderConfig>(update_sphere(index, point));
+  show_frame();
+}
+
+/* Moves a light source and re-renders the scene
+ *
+ * Direct lighting depends on the light position everywhere, so this always
+ * re-renders the whole screen. Lightmaps are not recomputed
+ */
+void move_light(uint8_t index, Vec3 point) {
+  lights.point[index] = point;
+  visibility.compute_all();
+
+  render_region<RenderConfig>(full_screen);
+  show_frame();
+}
+
+#ifdef __TICE__
+// How far each key press moves a sphere or light
+const Fixed24 edit_step(0.125f);
+
+/* Lets the scene be edited once the render has finished, re-rendering only
+ * what changes. The arrow keys move the selected object across the room,
+ * [+] and [-] raise and lower it, and [mode] selects the next sphere, or the
+ * lights after the spheres. Any other key exits
+ */
+void edit_scene() {
+  uint8_t count = spheres.count + lights.count;
+  uint8_t selected = 0;
+
+  while (true) {
+    uint8_t key;
+    while (!(key = os_GetCSC()));
+
+    Vec3 offset(0, 0, 0);
+
+    switch (key) {
+    case sk_Left:  offset.x = -edit_step; break;
+    case sk_Right: offset.x =  edit_step; break;
+    case sk_Up:    offset.z =  edit_step; break;
+    case sk_Down:  offset.z = -edit_step; break;
+    case sk_Add:   offset.y =  edit_step; break;
+    case sk_Sub:   offset.y = -edit_step; break;
+
+    case sk_Mode:
+      if (count) selected = (selected + 1) % count;
+      continue;
+
+    default:
+      return;
+    }
+
+    if (selected < spheres.count) {
+      move_sphere(selected, spheres.point[selected] + offset);
+    }
+    else if (selected < count) {
+      uint8_t light = selected - spheres.count;
+      move_light(light, lights.point[light] + offset);
+    }
+  }
+}
+#endif
+
+#if defined(VERIFY) && !defined(__TICE__)
+// Ordered dithering gives the same pixels in any region, so re-rendering a
+// region can be compared exactly against rendering the whole screen
+struct RegionTestConfig : RenderConfig {
+  static const DitherMode dither = DITHER_ORDERED;
+  static const bool checkerboard = false;
+};
+
+// The screen after re-rendering only the changed region
+Color region_screen[LCD_WIDTH * LCD_HEIGHT];
+
+/* Checks that the regions re-rendered when a sphere is moved cover every
+ * pixel which changes. Each sphere is moved a few ways, and the screen after
+ * re-rendering only its region is compared with a full render of the moved
+ * scene. Returns false if any pixel differs
+ */
+bool verify_moves() {
+  const Vec3 offsets[] = {
+    Vec3( 0.15f, 0.0f,  0.0f),
+    Vec3(-0.15f, 0.1f,  0.0f),
+    Vec3( 0.0f,  0.0f, -0.3f),
+    Vec3( 0.0f,  0.0f, -1.93f)
+  };
+
+  uint32_t differing = 0;
+
+  for (uint8_t i = 0; i < spheres.count; i++) {
+    for (const Vec3& offset : offsets) {
+      Vec3 point = spheres.point[i];
+
+      render_region<RegionTestConfig>(full_screen);
+      render_region<RegionTestConfig>(update_sphere(i, point + offset));
+
+      for (uint24_t p = 0; p < LCD_WIDTH * LCD_HEIGHT; p++) {
+        region_screen[p] = VRAM[p];
+      }
+
+      render_region<RegionTestConfig>(full_screen);
+
+      for (uint24_t p = 0; p < LCD_WIDTH * LCD_HEIGHT; p++) {
+        if (region_screen[p] != VRAM[p]) differing++;
+      }
+
+      update_sphere(i, point);
+    }
+  }
+
+  os_PutStrFull(differing ? "Region updates: FAIL" : "Region updates: PASS");
+  os_NewLine();
+
+  return differing == 0;
+}
+
+/* Lights the scene again from scratch
+ */
+void relight() {
+  progress.stage = STAGE_PLANES;
+  progress.bounce = 0;
+  progress.object = 0;
+  progress.updates = 0;
+
+  compute_illumination();
+  compute_radiosity();
+  visibility.compute_all();
+}
+
+/* Renders the whole screen again
+ */
+void rerender() {
+  progress.segment = 0;
+  progress.y = 0;
+
+  if (RenderConfig::supersample == 1) {
+    render<RenderConfig>();
+  }
+  else {
+    render_supersample<RenderConfig>();
+  }
+}
+
+/* Times lighting and rendering again over enough runs to measure, since
+ * each takes only milliseconds here. The result of the last run is the same
+ * as the first, so the screen still holds the render to check
+ */
+void time_phases(Verifier& verifier) {
+  host_quiet = true;
+
+  verifier.repeat_phase(VERIFY_LIGHTING, relight);
+  verifier.repeat_phase(VERIFY_RENDER, rerender);
+
+  host_quiet = false;
+}
+#endif
+
 int main(void)
 {
   /* Clear the homescreen */
   os_ClrHome();
 
-  scene_init();
+#ifdef VERIFY
+  Verifier verifier;
+#endif
+
+  bool finished = scene_init();
+
+#ifdef VERIFY
+  verifier.end_phase(VERIFY_LIGHTING);
+#endif
   
-  if (supersample == 1) {
-    render();
+  if (finished) {
+    start_display<RenderConfig>();
+    load_framebuffer(frame);
+
+    if (RenderConfig::supersample == 1) {
+      finished = render<RenderConfig>();
+    }
+    else
+    {
+      finished = render_supersample<RenderConfig>();
+    }
+  }
+
+#ifdef VERIFY
+  verifier.end_phase(VERIFY_RENDER);
+#endif
+
+  PROFILE_REPORT();
+
+  // If a key was pressed, save our progress so we can pick up from here 
+  // the next time the program is run
+  if (!finished) {
+    save_checkpoint(frame);
+    end_display();
+    unload_textures();
+    return 0;
+  }
+
+  clear_checkpoint();
+  show_frame();
+
+  // There is no keypad elsewhere, so don't wait for one
+#ifdef __TICE__
+#ifndef VERIFY
+  // The screen only shows one segment of a supersampled render, so it can
+  // only be edited otherwise
+  if (RenderConfig::supersample == 1) {
+    edit_scene();
   }
   else
+#endif
   {
-    render_supersample();
+    /* Waits for a key */
+    while (!os_GetCSC());
   }
-  
-  /* Waits for a key */
-  while (!os_GetCSC());
+#endif
+
+  end_display();
 
-  return 0;
-}
\ No newline at end of file
+#ifdef VERIFY
+#ifndef __TICE__
+  time_phases(verifier);
+#endif
+
+  // Report over the top of the render, then wait again so it can be read
+  bool pass = verifier.check(VRAM, RenderConfig::grain, RenderConfig::supersample);
+
+#ifdef __TICE__
+  while (!os_GetCSC());
+#else
+  // Also check that moving a sphere re-renders everything which changes
+  pass = verify_moves() && pass;
+#endif
+#else
+  bool pass = true;
+#endif
+
+  unload_textures();
+
+#ifdef VERIFY
+  // Slowdowns have their own status, since on a desktop machine they may
+  // just be noise worth measuring again
+  if (pass && verifier.slow) return 2;
+#endif
+
+  return pass ? 0 : 1;
+}
@@ -0,0 +1,299 @@
+#pragma once
+
+/* An 8bpp display mode, where each pixel is an index into a palette of 256
+ * colors chosen to suit the scene being rendered
+ *
+ * This halves the size of the framebuffer, which leaves room in VRAM for a
+ * second one. Rendering then draws to the hidden buffer and only swaps it
+ * onto the screen once complete. The mode is only compiled in when PALETTE is
+ * defined, for example with
+ *   make CXXFLAGS="-Wall -Wextra -Oz -DPALETTE"
+ *
+ * The palette is found by median cut over a histogram of the colors in a
+ * coarse render, taken once lighting is finished, so it covers the colors
+ * the lightmaps, textures and albedos actually produce. Colors are reduced
+ * to 4 bits per channel for the histogram, which splits color space into
+ * 4096 cells. Every box of the median cut is a block of whole cells, and the
+ * boxes tile the entire space, so an inverse lookup from cell to palette
+ * entry comes directly from the boxes without any nearest color search
+ */
+
+#include <tice.h>
+#include <graphx.h>
+#include <stdlib.h>
+#include "color.h"
+
+#define PALETTE_SIZE 256
+
+// Bits of each channel used to look up a palette entry
+#define PALETTE_CELL_BITS 4
+#define PALETTE_CELL_SIDE (1 << PALETTE_CELL_BITS)
+#define PALETTE_CELLS (PALETTE_CELL_SIDE * PALETTE_CELL_SIDE * PALETTE_CELL_SIDE)
+
+// Granularity of the render sampled to build the histogram
+#define PALETTE_SAMPLE_GRAIN 4
+
+#ifdef PALETTE
+// Pixels in the framebuffer are palette indices
+typedef uint8_t Pixel;
+#else
+typedef Color Pixel;
+#endif
+
+/* Returns the histogram cell holding a color
+ */
+uint24_t palette_cell(Color24 color) {
+  const uint8_t shift = 8 - PALETTE_CELL_BITS;
+
+  return ((uint24_t)(color.r >> shift) << (2 * PALETTE_CELL_BITS)) |
+         ((uint24_t)(color.g >> shift) << PALETTE_CELL_BITS) |
+          (color.b >> shift);
+}
+
+/* A box of histogram cells, inclusive of both corners, along with the number
+ * of samples inside it and the bounds of the cells holding them
+ */
+struct PaletteBox {
+  uint8_t lo[3];
+  uint8_t hi[3];
+  uint8_t used_lo[3];
+  uint8_t used_hi[3];
+  uint24_t count;
+};
+
+struct Palette {
+  // Palette entries in the 1555 format graphx expects
+  uint16_t colors[PALETTE_SIZE];
+
+  // The palette entry used for each histogram cell
+  uint8_t lookup[PALETTE_CELLS];
+
+  /* Adds an ordered dithering threshold to a color and looks up its palette
+   * entry. Thresholds are for dropping 3 bits, so they are doubled to cover
+   * the 4 bits dropped here
+   */
+  uint8_t index(Color24 color, uint8_t threshold) {
+    threshold *= 2;
+
+    uint8_t r = color.r + threshold;
+    uint8_t g = color.g + threshold;
+    uint8_t b = color.b + threshold;
+
+    // Clamp this addition if it ever overflows
+    if (r < color.r) r = 255;
+    if (g < color.g) g = 255;
+    if (b < color.b) b = 255;
+
+    return lookup[palette_cell(Color24(r, g, b))];
+  }
+
+  /* Counts the samples in a box and finds the bounds of the cells holding
+   * them
+   */
+  void measure(PaletteBox& box, const uint16_t* histogram) {
+    box.count = 0;
+
+    for (uint8_t i = 0; i < 3; i++) {
+      box.used_lo[i] = box.hi[i];
+      box.used_hi[i] = box.lo[i];
+    }
+
+    for (uint8_t r = box.lo[0]; r <= box.hi[0]; r++) {
+      for (uint8_t g = box.lo[1]; g <= box.hi[1]; g++) {
+        for (uint8_t b = box.lo[2]; b <= box.hi[2]; b++) {
+          uint16_t n = histogram[(r << (2 * PALETTE_CELL_BITS)) | (g << PALETTE_CELL_BITS) | b];
+          if (!n) continue;
+
+          box.count += n;
+
+          uint8_t cell[3] = { r, g, b };
+
+          for (uint8_t i = 0; i < 3; i++) {
+            if (cell[i] < box.used_lo[i]) box.used_lo[i] = cell[i];
+            if (cell[i] > box.used_hi[i]) box.used_hi[i] = cell[i];
+          }
+        }
+      }
+    }
+  }
+
+  /* Returns the axis along which the samples in a box are most spread out,
+   * storing how far they spread
+   */
+  uint8_t widest_axis(const PaletteBox& box, uint8_t& width) {
+    uint8_t axis = 0;
+    width = 0;
+
+    for (uint8_t i = 0; i < 3; i++) {
+      if (box.count == 0 || box.used_hi[i] < box.used_lo[i]) continue;
+
+      uint8_t w = box.used_hi[i] - box.used_lo[i];
+
+      if (w > width) {
+        width = w;
+        axis = i;
+      }
+    }
+
+    return axis;
+  }
+
+  /* Splits a box at the median of its samples along its widest axis, moving
+   * the upper half into another box. The split always falls between the
+   * cells holding samples, so neither half is empty
+   */
+  void split(PaletteBox& box, PaletteBox& upper, const uint16_t* histogram) {
+    uint8_t width;
+    uint8_t axis = widest_axis(box, width);
+
+    // Count the samples in each slice of the box along the axis
+    uint24_t slices[PALETTE_CELL_SIDE];
+
+    for (uint8_t i = 0; i < PALETTE_CELL_SIDE; i++) {
+      slices[i] = 0;
+    }
+
+    for (uint8_t r = box.lo[0]; r <= box.hi[0]; r++) {
+      for (uint8_t g = box.lo[1]; g <= box.hi[1]; g++) {
+        for (uint8_t b = box.lo[2]; b <= box.hi[2]; b++) {
+          uint8_t cell[3] = { r, g, b };
+
+          slices[cell[axis]] += histogram[(r << (2 * PALETTE_CELL_BITS)) | (g << PALETTE_CELL_BITS) | b];
+        }
+      }
+    }
+
+    uint8_t last = box.used_hi[axis];
+    uint8_t median = box.used_lo[axis];
+    uint24_t below = slices[median];
+
+    while (median + 1 < last && below * 2 < box.count) {
+      below += slices[++median];
+    }
+
+    upper = box;
+    upper.lo[axis] = median + 1;
+    box.hi[axis] = median;
+
+    measure(box, histogram);
+    measure(upper, histogram);
+  }
+
+  /* Builds the palette and lookup table from a histogram of sampled colors,
+   * with one count per cell
+   */
+  void build(const uint16_t* histogram) {
+    PaletteBox* boxes = (PaletteBox*)malloc(PALETTE_SIZE * sizeof(PaletteBox));
+    uint24_t count = 1;
+
+    if (!boxes) {
+      build_default();
+      return;
+    }
+
+    for (uint8_t i = 0; i < 3; i++) {
+      boxes[0].lo[i] = 0;
+      boxes[0].hi[i] = PALETTE_CELL_SIDE - 1;
+    }
+
+    measure(boxes[0], histogram);
+
+    // Repeatedly split the box which holds the most samples, weighted by
+    // how widely they are spread, until the palette is full
+    while (count < PALETTE_SIZE) {
+      uint24_t best = 0;
+      uint24_t best_score = 0;
+
+      for (uint24_t i = 0; i < count; i++) {
+        uint8_t width;
+        widest_axis(boxes[i], width);
+
+        uint24_t score = boxes[i].count * width;
+
+        if (score > best_score) {
+          best = i;
+          best_score = score;
+        }
+      }
+
+      // Every box holds samples from a single cell
+      if (best_score == 0) break;
+
+      split(boxes[best], boxes[count++], histogram);
+    }
+
+    for (uint24_t i = 0; i < PALETTE_SIZE; i++) {
+      colors[i] = i < count ? box_color(boxes[i], histogram) : 0;
+    }
+
+    // Point every cell at the box containing it
+    for (uint24_t i = 0; i < count; i++) {
+      PaletteBox& box = boxes[i];
+
+      for (uint8_t r = box.lo[0]; r <= box.hi[0]; r++) {
+        for (uint8_t g = box.lo[1]; g <= box.hi[1]; g++) {
+          for (uint8_t b = box.lo[2]; b <= box.hi[2]; b++) {
+            lookup[(r << (2 * PALETTE_CELL_BITS)) | (g << PALETTE_CELL_BITS) | b] = i;
+          }
+        }
+      }
+    }
+
+    free(boxes);
+  }
+
+  /* Builds a fixed palette with 8 levels of red and green and 4 of blue,
+   * used when there is no memory to build one for the scene
+   */
+  void build_default() {
+    for (uint24_t i = 0; i < PALETTE_SIZE; i++) {
+      colors[i] = gfx_RGBTo1555(((i >> 5) << 5) + 16, (((i >> 2) & 7) << 5) + 16,
+                                ((i & 3) << 6) + 32);
+    }
+
+    for (uint8_t r = 0; r < PALETTE_CELL_SIDE; r++) {
+      for (uint8_t g = 0; g < PALETTE_CELL_SIDE; g++) {
+        for (uint8_t b = 0; b < PALETTE_CELL_SIDE; b++) {
+          lookup[(r << (2 * PALETTE_CELL_BITS)) | (g << PALETTE_CELL_BITS) | b] =
+            ((r >> 1) << 5) | ((g >> 1) << 2) | (b >> 2);
+        }
+      }
+    }
+  }
+
+  /* Finds the mean color of the samples in a box, or the center of the box
+   * if it is empty
+   */
+  uint16_t box_color(const PaletteBox& box, const uint16_t* histogram) {
+    const uint8_t shift = 8 - PALETTE_CELL_BITS;
+    const uint8_t half = 1 << (shift - 1);
+
+    uint32_t sum[3] = { 0, 0, 0 };
+
+    for (uint8_t r = box.lo[0]; r <= box.hi[0]; r++) {
+      for (uint8_t g = box.lo[1]; g <= box.hi[1]; g++) {
+        for (uint8_t b = box.lo[2]; b <= box.hi[2]; b++) {
+          uint16_t n = histogram[(r << (2 * PALETTE_CELL_BITS)) | (g << PALETTE_CELL_BITS) | b];
+          uint8_t cell[3] = { r, g, b };
+
+          for (uint8_t i = 0; i < 3; i++) {
+            sum[i] += (uint32_t)n * ((cell[i] << shift) + half);
+          }
+        }
+      }
+    }
+
+    uint8_t mean[3];
+
+    for (uint8_t i = 0; i < 3; i++) {
+      mean[i] = box.count ? sum[i] / box.count
+                          : (((box.lo[i] + box.hi[i] + 1) << shift) / 2);
+    }
+
+    return gfx_RGBTo1555(mean[0], mean[1], mean[2]);
+  }
+};
+
+#ifdef PALETTE
+Palette palette;
+#endif
@@ -6,79 +6,147 @@
  * Planes can register the ray origin (camera position) before
  * computing intersections to avoid redundant computations when
  * the camera position is constant
+ *
+ * All planes in the scene are stored together as a structure of arrays. Only
+ * the values needed to intersect rays live here, and shading data (albedo,
+ * texture and lightmap) is kept in separate tables indexed the same way,
+ * since it is only needed once the closest hit has been found
  */
 
 #include "vector.h"
 #include "ray.h"
 #include "color.h"
 #include "texture.h"
+#include "spectrum.h"
 #include "lightmap.h"
 
-struct Plane {
-  Vec3 point;
-  Vec3 normal;
-  Spectrum albedo;
-  LightMap light_map;
-  Texture* texture;
+// Capacity of the scene. Each plane has its own lightmap, so this is kept
+// small to save RAM
+#define MAX_PLANES 6
+
+struct Planes;
+
+// Computes the t parameter where a ray intersects one of the planes
+typedef Fixed24 (*PlaneKernel)(Planes& planes, uint8_t i, Ray& r);
 
-  // Precomputed value to speed up the math
-  Fixed24 numerator;
+struct Planes {
+  uint8_t count;
 
-  Plane(Vec3 _point, Vec3 _normal, Color _color, Texture *_texture) {
-    point   = _point;
-    normal  = _normal;
-    albedo = Spectrum(_color);
-    texture = _texture;
+  Vec3 point[MAX_PLANES];
+  Vec3 normal[MAX_PLANES];
+
+  // Precomputed values to speed up the math
+  Fixed24 numerator[MAX_PLANES];
+
+  // The axis each plane faces along, and the axes of its texture coordinates
+  uint8_t axis[MAX_PLANES];
+  uint8_t u_axis[MAX_PLANES];
+  uint8_t v_axis[MAX_PLANES];
+
+  // Intersection kernels specialised for the orientation of each plane
+  PlaneKernel fast_kernel[MAX_PLANES];
+  PlaneKernel kernel[MAX_PLANES];
+
+  Planes() {
+    count = 0;
+  }
+
+  void set(uint8_t i, Vec3 _point, Vec3 _normal) {
+    point[i]  = _point;
+    normal[i] = _normal;
+
+    select_kernels(i);
+  }
+
+  /* Picks the texture axes and intersection kernels for plane i based on
+   * its normal. Every plane in a box scene faces along an axis, which lets
+   * the kernels skip most of the general intersection math while giving the
+   * exact same results
+   */
+  void select_kernels(uint8_t i) {
+    Vec3& n = normal[i];
+
+    // Texture coordinates are taken from the two axes the plane spans
+    axis[i] = n.z.n ? 2 : (n.y.n ? 1 : 0);
+    u_axis[i] = axis[i] == 0 ? 2 : 0;
+    v_axis[i] = axis[i] == 1 ? 2 : 1;
+
+    fast_kernel[i] = intersect_fast_any;
+    kernel[i] = intersect_any;
+
+    // Planes which are not exactly axis aligned need the general kernels
+    bool negative = n[axis[i]].n < 0;
+
+    if (n[u_axis[i]].n || n[v_axis[i]].n) return;
+    if (n[axis[i]].n != (negative ? -(1 << POINT) : (1 << POINT))) return;
+
+    static const PlaneKernel fast_kernels[] = {
+      intersect_fast<0, false>, intersect_fast<0, true>,
+      intersect_fast<1, false>, intersect_fast<1, true>,
+      intersect_fast<2, false>, intersect_fast<2, true>
+    };
+
+    static const PlaneKernel kernels[] = {
+      intersect<0, false>, intersect<0, true>,
+      intersect<1, false>, intersect<1, true>,
+      intersect<2, false>, intersect<2, true>
+    };
+
+    fast_kernel[i] = fast_kernels[axis[i] * 2 + negative];
+    kernel[i] = kernels[axis[i] * 2 + negative];
   }
 
   /* Precompute some of the ray intersection math which is not dependent on
    * ray direction. This only needs updated whenever the camera position
    * is changed
    */
-  void register_camera(Vec3 &origin) {
-    Vec3 offset = point - origin;
+  void register_camera(uint8_t i, Vec3 &origin) {
+    Vec3 offset = point[i] - origin;
 
-    numerator = dot(offset, normal);
+    numerator[i] = dot(offset, normal[i]);
   }
 
-  /* Compute the t parameter where this ray intersects with the plane.
+  /* Compute the t parameter where this ray intersects with plane i.
    * t < 0 implies no intersection
-   * 
+   *
    * Requires register_camera to have been called earlier with the correct
    * camera position.
    */
-  Fixed24 ray_intersect_fast(Ray &r) {
-    Fixed24 t = div(numerator, dot(r.dir, normal));
-
-    Vec3 hit_pos = r.at(t);
-    hit_pos = hit_pos - point;
-
-    // Restrict intersections to the 2x2x2 scene region
-    if (hit_pos.x > Fixed24(2.01f)) return Fixed24(-1);
-    if (hit_pos.y > Fixed24(2.01f)) return Fixed24(-1);
-    if (hit_pos.z > Fixed24(2.01f)) return Fixed24(-1);
-    if (hit_pos.x < Fixed24(-.01f)) return Fixed24(-1);
-    if (hit_pos.y < Fixed24(-.01f)) return Fixed24(-1);
-    if (hit_pos.z < Fixed24(-.01f)) return Fixed24(-1);
-
-    return t;
+  Fixed24 ray_intersect_fast(uint8_t i, Ray &r) {
+    return fast_kernel[i](*this, i, r);
   }
 
-  /* Compute the t parameter where this ray intersects with the plane.
+  /* Compute the t parameter where this ray intersects with plane i.
    * t < 0 implies no intersection
    *
    * This implementation does not rely on precomputed values, thus it
    * can be used for any ray r, although it will be somewhat slower
    */
-  Fixed24 ray_intersect(Ray& r) {
-    Vec3 offset = point - r.origin;
+  Fixed24 ray_intersect(uint8_t i, Ray& r) {
+    return kernel[i](*this, i, r);
+  }
 
-    Fixed24 t = div(dot(offset, normal), dot(r.dir, normal));
+  /* Computes the texture coordinates of a point on plane i, relative to the
+   * plane origin
+   */
+  void uv(uint8_t i, Vec3& pos, Fixed24& u, Fixed24& v) {
+    u = pos[u_axis[i]] - point[i][u_axis[i]];
+    v = pos[v_axis[i]] - point[i][v_axis[i]];
+  }
 
+  /* Computes the world space position of a lightmap sample on plane i
+   */
+  Vec3 sample_pos(uint8_t i, uint8_t x, uint8_t y) {
+    return get_sample_pos(point[i], u_axis[i], v_axis[i], x, y);
+  }
+
+  /* Restricts intersections to the 2x2x2 scene region, returning t if the
+   * hit position lies on the plane segment and -1 otherwise
+   */
+  Fixed24 clip(uint8_t i, Ray &r, Fixed24 t) {
     Vec3 hit_pos = r.at(t);
-    hit_pos = hit_pos - point;
+    hit_pos = hit_pos - point[i];
 
-    // Restrict intersections to the 2x2x2 scene region
     if (hit_pos.x > Fixed24(2.01f)) return Fixed24(-1);
     if (hit_pos.y > Fixed24(2.01f)) return Fixed24(-1);
     if (hit_pos.z > Fixed24(2.01f)) return Fixed24(-1);
@@ -88,4 +156,79 @@ struct Plane {
 
     return t;
   }
+
+  /* Restricts intersections with a plane facing along the given axis to the
+   * 2x2 square it covers. Only the two axes the plane spans need checking
+   */
+  template <uint8_t axis>
+  Fixed24 clip(uint8_t i, Ray &r, Fixed24 t) {
+    const uint8_t u = axis == 0 ? 2 : 0;
+    const uint8_t v = axis == 1 ? 2 : 1;
+
+    Fixed24 hit_u = r.origin[u] + (r.dir[u] * t) - point[i][u];
+    Fixed24 hit_v = r.origin[v] + (r.dir[v] * t) - point[i][v];
+
+    if (hit_u > Fixed24(2.01f)) return Fixed24(-1);
+    if (hit_v > Fixed24(2.01f)) return Fixed24(-1);
+    if (hit_u < Fixed24(-.01f)) return Fixed24(-1);
+    if (hit_v < Fixed24(-.01f)) return Fixed24(-1);
+
+    return t;
+  }
+
+  static Fixed24 intersect_fast_any(Planes& p, uint8_t i, Ray &r) {
+    Fixed24 d = dot(r.dir, p.normal[i]);
+
+    // Rays (nearly) parallel to the plane never hit it
+    if (d.n >= -2 && d.n <= 2) return Fixed24(-1);
+
+    Fixed24 t = div(p.numerator[i], d);
+
+    return p.clip(i, r, t);
+  }
+
+  static Fixed24 intersect_any(Planes& p, uint8_t i, Ray& r) {
+    Vec3 offset = p.point[i] - r.origin;
+    Fixed24 d = dot(r.dir, p.normal[i]);
+
+    if (d.n >= -2 && d.n <= 2) return Fixed24(-1);
+
+    Fixed24 t = div(dot(offset, p.normal[i]), d);
+
+    return p.clip(i, r, t);
+  }
+
+  /* With a unit normal along an axis, the dot product with the ray direction
+   * is just one of its components, possibly negated
+   */
+  template <uint8_t axis, bool negative>
+  static Fixed24 intersect_fast(Planes& p, uint8_t i, Ray &r) {
+    Fixed24 d = negative ? -r.dir[axis] : r.dir[axis];
+
+    if (d.n >= -2 && d.n <= 2) return Fixed24(-1);
+
+    Fixed24 t = div(p.numerator[i], d);
+
+    return p.clip<axis>(i, r, t);
+  }
+
+  template <uint8_t axis, bool negative>
+  static Fixed24 intersect(Planes& p, uint8_t i, Ray& r) {
+    Fixed24 offset = p.point[i][axis] - r.origin[axis];
+    Fixed24 d = negative ? -r.dir[axis] : r.dir[axis];
+
+    if (d.n >= -2 && d.n <= 2) return Fixed24(-1);
+
+    Fixed24 t = div(negative ? -offset : offset, d);
+
+    return p.clip<axis>(i, r, t);
+  }
+};
+
+/* Shading properties of a plane, only looked at once a ray is known to have
+ * hit it
+ */
+struct PlaneMaterial {
+  Spectrum albedo;
+  Texture* texture;
 };
\ No newline at end of file
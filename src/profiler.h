@@ -0,0 +1,334 @@
+#pragma once
+
+/* A lightweight profiler which records the total time spent in, and number of
+ * entries to, a few regions of the program
+ *
+ * On the calculator, time is measured in CPU cycles with hardware timer 1. On
+ * other platforms it is measured in nanoseconds with clock_gettime
+ *
+ * Profiling is only compiled in when PROFILE is defined, for example with
+ *   make CXXFLAGS="-Wall -Wextra -Oz -DPROFILE"
+ * Otherwise every profiling macro expands to nothing
+ *
+ * Regions may nest inside each other (shading includes the reflection rays it
+ * traces, for example), so times are inclusive and do not sum to the total.
+ * A region entered again before it has ended, such as shading for a
+ * reflection, is counted as another entry but only timed once
+ *
+ * Separately, defining COUNT_OPS counts the fixed point operations performed
+ * in each region, since they differ greatly in cost despite looking the same
+ * in the code. Operations are counted against the innermost region they occur
+ * in (so these counts do sum to the total), or "other" outside all regions.
+ * The counts are saved as CSV to the RTOPS AppVar when the program exits
+ */
+
+#include <tice.h>
+
+enum ProfileRegion {
+  PROF_SHADOWS,
+  PROF_PLANE_RADIOSITY,
+  PROF_SPHERE_RADIOSITY,
+  PROF_GATHER,
+  PROF_INTERSECT,
+  PROF_SHADING,
+  PROF_GAMMA,
+  PROF_DITHER,
+  PROF_COUNT
+};
+
+// Kinds of fixed point operations counted with COUNT_OPS. Subtraction and
+// negation count as adds, and div counts as both a divide and a multiply
+enum OpType {
+  OP_ADD,
+  OP_MUL,
+  OP_SQR,
+  OP_DIV,
+  OP_SQRT,
+  OP_LUT,
+  OP_COUNT
+};
+
+#if defined(PROFILE) || defined(COUNT_OPS)
+
+#ifdef PROFILE
+#ifdef __TICE__
+#include <sys/timers.h>
+#else
+#include <stdio.h>
+#include <time.h>
+#endif
+#endif
+
+#include "appvar.h"
+
+// The AppVars the reports are written to
+#define PROFILE_VAR "RTPROF"
+#define OPS_VAR "RTOPS"
+
+#ifdef __TICE__
+#define PROFILE_TICKS_PER_SECOND 48000000
+#else
+#define PROFILE_TICKS_PER_SECOND 1000000000
+#endif
+
+const char* profile_names[PROF_COUNT] = {
+  "shadows",
+  "plane radiosity",
+  "sphere radiosity",
+  "gather",
+  "intersect",
+  "shading",
+  "gamma",
+  "dither",
+};
+
+const char* op_names[OP_COUNT] = {
+  "add",
+  "mul",
+  "sqr",
+  "div",
+  "sqrt",
+  "lut",
+};
+
+/* Writes an unsigned integer in decimal
+ */
+void write_decimal(var_t var, uint32_t n) {
+  char str[11];
+  uint8_t i = sizeof(str);
+
+  do {
+    str[--i] = '0' + n % 10;
+    n /= 10;
+  } while (n);
+
+  write_var(var, &str[i], sizeof(str) - i);
+}
+
+void write_string(var_t var, const char* str) {
+  uint8_t length = 0;
+  while (str[length]) length++;
+
+  write_var(var, str, length);
+}
+
+struct ProfileRecord {
+  uint64_t ticks;
+  uint32_t calls;
+};
+
+struct Profiler {
+  // How many times each region is currently entered
+  uint8_t depth[PROF_COUNT];
+
+#ifdef PROFILE
+  ProfileRecord records[PROF_COUNT];
+
+  // Time each region was entered at
+  uint64_t start[PROF_COUNT];
+#endif
+
+#ifdef COUNT_OPS
+  // Operations performed in each region, with a final row for those outside
+  // of any region
+  uint32_t ops[PROF_COUNT + 1][OP_COUNT];
+
+  // The innermost region currently entered, and the region which was
+  // innermost before each one was entered
+  uint8_t current;
+  uint8_t parent[PROF_COUNT];
+#endif
+
+#if defined(PROFILE) && defined(__TICE__)
+  // The hardware counter is only 32 bits, which wraps after about 89 seconds
+  // at 48MHz. Wraps are counted between reads to extend it, so regions can
+  // run longer than that as long as something is profiled in the meantime
+  uint32_t last;
+  uint64_t high;
+#endif
+
+  Profiler() {
+    for (uint8_t i = 0; i < PROF_COUNT; i++) {
+      depth[i] = 0;
+    }
+
+#ifdef COUNT_OPS
+    for (uint8_t i = 0; i <= PROF_COUNT; i++) {
+      for (uint8_t op = 0; op < OP_COUNT; op++) {
+        ops[i][op] = 0;
+      }
+    }
+
+    current = PROF_COUNT;
+#endif
+
+#ifdef PROFILE
+    for (uint8_t i = 0; i < PROF_COUNT; i++) {
+      records[i].ticks = 0;
+      records[i].calls = 0;
+    }
+#endif
+
+#if defined(PROFILE) && defined(__TICE__)
+    last = 0;
+    high = 0;
+
+    timer_Disable(1);
+    timer_Set(1, 0);
+    timer_Enable(1, TIMER_CPU, TIMER_NOINT, TIMER_UP);
+#endif
+  }
+
+#ifdef PROFILE
+  uint64_t now() {
+#ifdef __TICE__
+    uint32_t ticks = timer_Get(1);
+
+    if (ticks < last) high += (uint64_t)1 << 32;
+    last = ticks;
+
+    return high | ticks;
+#else
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+#endif
+  }
+#endif
+
+  void begin(uint8_t region) {
+#ifdef PROFILE
+    records[region].calls++;
+#endif
+
+    if (depth[region]++ == 0) {
+#ifdef COUNT_OPS
+      parent[region] = current;
+      current = region;
+#endif
+#ifdef PROFILE
+      start[region] = now();
+#endif
+    }
+  }
+
+  void end(uint8_t region) {
+    if (--depth[region] == 0) {
+#ifdef PROFILE
+      records[region].ticks += now() - start[region];
+#endif
+#ifdef COUNT_OPS
+      current = parent[region];
+#endif
+    }
+  }
+
+  void report() {
+#ifdef PROFILE
+    report_time();
+#endif
+#ifdef COUNT_OPS
+    report_ops();
+#endif
+  }
+
+#ifdef PROFILE
+  /* Writes the totals for every region. On the calculator, the PROFILE_VAR
+   * AppVar holds the tick rate as a uint32_t followed by a ProfileRecord for
+   * each region in the order of ProfileRegion. Elsewhere a table is printed
+   */
+  void report_time() {
+#ifdef __TICE__
+    var_t var = open_var(PROFILE_VAR, "w");
+    if (!var) return;
+
+    uint32_t rate = PROFILE_TICKS_PER_SECOND;
+
+    write_var(var, &rate, sizeof(rate));
+    write_var(var, records, sizeof(records));
+    close_var(var);
+#else
+    printf("%-18s %12s %12s\n", "region", "calls", "ms");
+
+    for (uint8_t i = 0; i < PROF_COUNT; i++) {
+      printf("%-18s %12lu %12.3f\n", profile_names[i],
+        (unsigned long)records[i].calls,
+        records[i].ticks * 1000.0 / PROFILE_TICKS_PER_SECOND);
+    }
+#endif
+  }
+#endif
+
+#ifdef COUNT_OPS
+  /* Writes the operation counts as CSV, with a row for each region and a
+   * column for each kind of operation
+   */
+  void report_ops() {
+    var_t var = open_var(OPS_VAR, "w");
+    if (!var) return;
+
+    write_string(var, "region");
+
+    for (uint8_t op = 0; op < OP_COUNT; op++) {
+      write_string(var, ",");
+      write_string(var, op_names[op]);
+    }
+
+    write_string(var, "\n");
+
+    for (uint8_t i = 0; i <= PROF_COUNT; i++) {
+      write_string(var, i < PROF_COUNT ? profile_names[i] : "other");
+
+      for (uint8_t op = 0; op < OP_COUNT; op++) {
+        write_string(var, ",");
+        write_decimal(var, ops[i][op]);
+      }
+
+      write_string(var, "\n");
+    }
+
+    close_var(var);
+  }
+#endif
+};
+
+Profiler profiler;
+
+/* Ends a region when leaving the scope it was started in, so functions with
+ * several returns only need to be marked once
+ */
+struct ProfileScope {
+  uint8_t region;
+
+  ProfileScope(uint8_t _region) {
+    region = _region;
+    profiler.begin(region);
+  }
+
+  ~ProfileScope() {
+    profiler.end(region);
+  }
+};
+
+#define PROFILE_BEGIN(region) profiler.begin(region)
+#define PROFILE_END(region) profiler.end(region)
+#define PROFILE_SCOPE(region) ProfileScope profile_scope(region)
+#define PROFILE_REPORT() profiler.report()
+
+#else
+
+#define PROFILE_BEGIN(region)
+#define PROFILE_END(region)
+#define PROFILE_SCOPE(region)
+#define PROFILE_REPORT()
+
+#endif
+
+#ifdef COUNT_OPS
+#define COUNT_OP(op) profiler.ops[profiler.current][op]++
+#define COUNT_OPS_N(op, n) profiler.ops[profiler.current][op] += n
+#else
+#define COUNT_OP(op)
+#define COUNT_OPS_N(op, n)
+#endif
@@ -9,39 +9,78 @@
  * position.
  */
 
+// When updating saved lighting, changes in emitted light smaller than this
+// are dropped rather than bounced around the scene
+const Fixed24 update_threshold(1.0f / 512);
+
 #include <math.h>
 #include "scene.h"
+#include "checkpoint.h"
+#include "lightcache.h"
+#include "fixed16.h"
+#include "profiler.h"
+
+// Elsewhere than the calculator, each bounce of plane radiosity is spread
+// across threads. The profiler keeps global counters, so profiled builds stay
+// on one thread. RADIOSITY_THREADS sets the number of threads, or 0 for one
+// per core
+#if !defined(__TICE__) && !defined(PROFILE) && !defined(COUNT_OPS)
+#define PARALLEL_RADIOSITY
+
+#ifndef RADIOSITY_THREADS
+#define RADIOSITY_THREADS 0
+#endif
+
+#include <thread>
+#include <vector>
+#endif
 
 /* Initializes the lightmap of a scene plane based on direct illumination
- * from the light source, occluded by scene objects light spheres
+ * from the light sources, occluded by scene objects light spheres
  */
-void compute_shadows(Plane& plane) {
-  Spectrum spectrum = plane.albedo;
+void compute_shadows(uint8_t index) {
+  PROFILE_SCOPE(PROF_SHADOWS);
+
+  Vec3& normal = planes.normal[index];
+  LightMap& light_map = plane_maps[index];
+
+  Spectrum spectrum = plane_materials[index].albedo;
 
   // Compute shadows on the floor plane
   for (uint8_t y = 0; y < MAP_SIZE; y++) {
     for (uint8_t x = 0; x < MAP_SIZE; x++) {
-      Vec3 shadowOrigin = get_sample_pos(plane.point, plane.normal, x, y);
+      Vec3 shadowOrigin = planes.sample_pos(index, x, y);
 
-      Ray shadow_ray(shadowOrigin, light - shadowOrigin);
+      Spectrum emitted;
 
-      // Compute the lambertian attenuation of the lighting at this sample point
-      Fixed24 attenuation = div(dot(plane.normal, shadow_ray.dir),
-        shadow_ray.dir.norm() * shadow_ray.dir.norm_squared());
-
-      attenuation = clamp0(attenuation);
+      for (uint8_t l = 0; l < lights.count; l++) {
+        Ray shadow_ray(shadowOrigin, lights.point[l] - shadowOrigin);
+        RayContext ctx(shadow_ray);
 
-      // Set the texture color to the albedo color
-      plane.light_map.emissive[x][y] = spectrum * attenuation;
+        // Skip this light if a sphere obstructs it
+        bool shadowed = false;
 
-      // Shade this location if a sphere obstructs it
-      for (Sphere& obj : spheres) {
-        obj.register_camera(shadow_ray.origin);
-        if (obj.ray_intersect(shadow_ray).n > 0) {
-          plane.light_map.emissive[x][y] = Spectrum(BLACK);
-          break;
+        for (uint8_t i = 0; i < spheres.count; i++) {
+          if (spheres.ray_intersect(i, shadow_ray, ctx).n > 0) {
+            shadowed = true;
+            break;
+          }
         }
+
+        if (shadowed) continue;
+
+        // Compute the lambertian attenuation of the lighting at this sample
+        // point
+        Fixed24 attenuation = div(dot16(normal, shadow_ray.dir),
+          sqrt(ctx.dir_norm2) * ctx.dir_norm2);
+
+        attenuation = clamp0(attenuation) * lights.intensity[l];
+
+        // Light the texture with the albedo color
+        emitted += spectrum * attenuation;
       }
+
+      light_map.emissive[x][y] = emitted;
     }
   }
 }
@@ -52,98 +91,166 @@ void compute_shadows(Plane& plane) {
  * Shadows cast by scene objects are ignored here for efficiency, though this
  * does make the results somewhat inaccurate
  */
-Spectrum compute_incident_radiosity(Plane& plane, Vec3& in_pos, Vec3& normal) {
+Spectrum compute_incident_radiosity(uint8_t index, Vec3& in_pos, Vec3& normal) {
+  PROFILE_SCOPE(PROF_GATHER);
+
+  Vec3& out_normal = planes.normal[index];
+  LightMap& light_map = plane_maps[index];
+
   Spectrum incident;
 
 
   for (uint8_t y = 0; y < MAP_SIZE; y++) {
     for (uint8_t x = 0; x < MAP_SIZE; x++) {
-      Vec3 out_pos = get_sample_pos(plane.point, plane.normal, x, y);
+      Spectrum& emitted = light_map.emissive[x][y];
+
+      // Patches in shadow, or which did not change when updating, add
+      // nothing
+      if (emitted.r.n == 0 && emitted.g.n == 0 && emitted.b.n == 0) continue;
+
+      Vec3 out_pos = planes.sample_pos(index, x, y);
       Vec3 dir = out_pos - in_pos;
       
       // Compute the lambertian attenuation of the lighting at this sample point
-      Fixed24 attenuation = dot(normal, dir) * -dot(plane.normal, dir);
+      Fixed24 attenuation = dot16(normal, dir) * -dot16(out_normal, dir);
 
       attenuation = clamp0(div(attenuation, sqr(dir.norm_squared())));
 
       // Contributed reflectance is the amount emitted by the plane scaled
       // by the attenuation based on distance and angle
-      Spectrum s = plane.light_map.emissive[x][y];
-
-      s.r = s.r * attenuation;
-      s.g = s.g * attenuation;
-      s.b = s.b * attenuation;
-
-      incident += s;
+      incident += emitted * attenuation;
     }
   }
 
   // After adding up all contributions from the other plane, we scale
   // with respect to the surface area of each emitting patch
-  incident.r = incident.r * Fixed24(1.0f / (MAP_SIZE * MAP_SIZE));
-  incident.g = incident.g * Fixed24(1.0f / (MAP_SIZE * MAP_SIZE));
-  incident.b = incident.b * Fixed24(1.0f / (MAP_SIZE * MAP_SIZE));
+  return incident * Fixed24(1.0f / (MAP_SIZE * MAP_SIZE));
+}
+
+/* Given a plane, computes the incident illumination for one row of patches
+ * in the lightmap. The albedo is applied when the bounce is finished, so
+ * the lightmap keeps the irradiance for shading
+ */
+void compute_plane_row(uint8_t index, uint8_t y0) {
+  Vec3& normal = planes.normal[index];
+
+  for (uint8_t x0 = 0; x0 < MAP_SIZE; x0++) {
+
+    Vec3 in_pos = planes.sample_pos(index, x0, y0);
+
+    Spectrum incident;
+
+    for (uint8_t i = 0; i < planes.count; i++) {
+      // Ignore self-illumination
+      if (i == index) continue;
+      incident += compute_incident_radiosity(i, in_pos, normal);
+    }
 
-  return incident;
+    // Divide by pi because calculus
+    plane_maps[index].emissive2[x0][y0] = incident * Fixed24(1.0f / (float)M_PI);
+  }
 }
 
 /* Given a plane, computes the incident illumination for all patches in the 
  * lightmap. (ie, one light bounce from the scene)
+ *
+ * Work resumes from the row stored in progress, and the keyboard is polled 
+ * between rows. Returns false if interrupted before finishing
  */
-void compute_plane_radiosity(Plane& plane) {
-  Spectrum albedo = plane.albedo;
+bool compute_plane_radiosity(uint8_t index) {
+  PROFILE_SCOPE(PROF_PLANE_RADIOSITY);
 
-  for (uint8_t y0 = 0; y0 < MAP_SIZE; y0++) {
-    for (uint8_t x0 = 0; x0 < MAP_SIZE; x0++) {
+  for (; progress.row < MAP_SIZE; progress.row++) {
+    if (interrupted()) return false;
 
-      Vec3 in_pos = get_sample_pos(plane.point, plane.normal, x0, y0);
+    compute_plane_row(index, progress.row);
+  }
 
-      Spectrum incident;
+  progress.row = 0;
+  return true;
+}
 
-      for (Plane& out_plane : sceneObjs) {
-        // Ignore self-illumination
-        if (&plane == &out_plane) continue;
-        incident += compute_incident_radiosity(out_plane, in_pos, plane.normal);
-      }
+#ifdef PARALLEL_RADIOSITY
+/* Computes one light bounce for the planes from progress.object onwards,
+ * spread across a thread per core
+ *
+ * Each bounce only reads emissive and only writes emissive2, and every patch
+ * is written by exactly one thread, so no locking is needed. The rows are
+ * dealt out to the threads in a fixed order, and each patch is computed the
+ * same way whichever thread does it, so the results do not depend on the
+ * number of threads
+ */
+void compute_bounce_parallel() {
+  uint24_t first = progress.object * MAP_SIZE;
+  uint24_t rows = planes.count * MAP_SIZE;
 
-      // Divide by pi because calculus
-      incident.r = incident.r * albedo.r * Fixed24(1.0f / (float)M_PI);
-      incident.g = incident.g * albedo.g * Fixed24(1.0f / (float)M_PI);
-      incident.b = incident.b * albedo.b * Fixed24(1.0f / (float)M_PI);
+  uint24_t count = RADIOSITY_THREADS ? RADIOSITY_THREADS
+                                     : std::thread::hardware_concurrency();
+  if (count == 0) count = 1;
 
-      plane.light_map.emissive2[x0][y0] = incident;
-    }
+  std::vector<std::thread> threads;
+
+  for (uint24_t t = 0; t < count; t++) {
+    threads.emplace_back([=]() {
+      for (uint24_t row = first + t; row < rows; row += count) {
+        compute_plane_row(row / MAP_SIZE, row % MAP_SIZE);
+      }
+    });
   }
 
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+
+  progress.object = planes.count;
+  progress.row = 0;
 }
+#endif
 
-/* Given a sphere, computes the incident illumination for all patches in the 
- * lightmap. (ie, one light bounce from the scene)
+/* Given a sphere, projects the light arriving at its center from every plane
+ * patch into its irradiance. (ie, one light bounce from the scene)
+ *
+ * Shading then evaluates this from the surface normal, which stands in for
+ * gathering at each point on the surface. Shadows are ignored, as for planes
  */
-void compute_sphere_radiosity(Sphere& sphere) {
-  for (uint8_t y0 = 0; y0 < MAP_SIZE; y0++) {
-    for (uint8_t x0 = 0; x0 < MAP_SIZE; x0++) {
+void compute_sphere_radiosity(uint8_t index) {
+  PROFILE_SCOPE(PROF_SPHERE_RADIOSITY);
 
-      Vec3 normal = get_sample_pos(x0, y0);
-      Vec3 point = (normal * sphere.radius) + sphere.point;
+  Vec3& center = spheres.point[index];
+  SphereIrradiance& irradiance = sphere_irradiance[index];
 
-      Spectrum incident;
+  irradiance.clear();
 
-      for (Plane& out_plane : sceneObjs) {
-        incident += compute_incident_radiosity(out_plane, point, normal);
-      }
+  for (uint8_t i = 0; i < planes.count; i++) {
+    Vec3& out_normal = planes.normal[i];
+    LightMap& light_map = plane_maps[i];
+
+    for (uint8_t y = 0; y < MAP_SIZE; y++) {
+      for (uint8_t x = 0; x < MAP_SIZE; x++) {
+        Spectrum& emitted = light_map.emissive[x][y];
+
+        if (emitted.r.n == 0 && emitted.g.n == 0 && emitted.b.n == 0) continue;
 
-      // This is not physically accurate, but it does help to emphasize the
-      // effects of color bleeding, so global illumination is stronger on 
-      // spheres
-      incident.r = incident.r * Fixed24((float)M_PI);
-      incident.g = incident.g * Fixed24((float)M_PI);
-      incident.b = incident.b * Fixed24((float)M_PI);
+        Vec3 dir = planes.sample_pos(i, x, y) - center;
 
-      sphere.light_map.bitmap[x0][y0] = incident;
+        Fixed24 dist2 = dir.norm_squared();
+        Fixed24 dist = sqrt(dist2);
+
+        // The solid angle of the patch seen from the center, relative to its
+        // area
+        Fixed24 attenuation = clamp0(div(-dot16(out_normal, dir), dist * dist2));
+
+        dir = dir * recip(dist);
+
+        irradiance.add(emitted * attenuation, dir);
+      }
     }
   }
 
+  // This is not physically accurate, but it does help to emphasize the
+  // effects of color bleeding, so global illumination is stronger on 
+  // spheres
+  irradiance.scale(Fixed24((float)(M_PI / (MAP_SIZE * MAP_SIZE))));
 }
 
 /* Computes direct illumination lightmaps for all objects in the scene
@@ -155,62 +262,158 @@ void compute_illumination() {
   os_NewLine();
 
   // Compute shading for all planes in the scene
-  for (Plane& plane : sceneObjs) {
-    compute_shadows(plane);
-    plane.light_map.clear();
+  for (uint8_t i = 0; i < planes.count; i++) {
+    compute_shadows(i);
+    plane_maps[i].clear();
+  }
+
+  for (uint8_t i = 0; i < spheres.count; i++) {
+    sphere_irradiance[i].clear();
+  }
+}
+
+/* Prepares to update the lighting saved by a previous run for the current
+ * scene, rather than computing it from scratch. Returns false if there is no
+ * saved lighting which can be updated
+ *
+ * Radiosity is linear in the direct lighting, so only the change in direct
+ * lighting since the saved run needs to be bounced around the scene. The
+ * saved direct lighting is recomputed from the old light and sphere
+ * positions, then emissive is set to the difference from the new direct
+ * lighting, while the plane bitmaps keep the saved solution. The usual
+ * bounces in compute_radiosity then add the change onto it
+ */
+bool warm_start() {
+  LightCache cache;
+  if (!load_lighting(cache)) return false;
+
+  os_PutStrFull("Updating Shadows");
+  os_NewLine();
+
+  Lights new_lights = lights;
+  Vec3 new_point[MAX_SPHERES];
+  Fixed24 new_radius[MAX_SPHERES];
+
+  // Put the scene back the way it was for the saved lighting
+  lights = cache.lights;
+
+  for (uint8_t i = 0; i < spheres.count; i++) {
+    new_point[i] = spheres.point[i];
+    new_radius[i] = spheres.radius[i];
+
+    spheres.set(i, cache.sphere_point[i], cache.sphere_radius[i]);
   }
 
-  for (Sphere& sphere : spheres) {
-    sphere.light_map.clear();
+  for (uint8_t i = 0; i < planes.count; i++) {
+    compute_shadows(i);
+    plane_maps[i].keep_emissive();
   }
+
+  lights = new_lights;
+
+  for (uint8_t i = 0; i < spheres.count; i++) {
+    spheres.set(i, new_point[i], new_radius[i]);
+  }
+
+  for (uint8_t i = 0; i < planes.count; i++) {
+    compute_shadows(i);
+    plane_maps[i].emissive_delta();
+  }
+
+  for (uint8_t i = 0; i < spheres.count; i++) {
+    sphere_irradiance[i].clear();
+  }
+
+  progress.updates = cache.updates + 1;
+
+  return true;
 }
 
 /* Computes radiosity for all lightmaps in the scene. This involves computing
  * a few rounds of light bounces to approximate global illumination. 
  *
  * Generally results converge decently after 2 bounces for the provided scene
+ *
+ * Progress is tracked so that this can be resumed after an interruption. 
+ * Returns false if interrupted before finishing
  */
-void compute_radiosity() {
-  os_PutStrFull("Computing Plane Radiosity");
-  os_NewLine();
-  
-  // Compute radiosity light bounces
-  for (uint8_t i = 0; i < 2; i++) {
-    // Print the round number
-    char str[2];
-    str[0] = digits[i + 1];
-    str[1] = '\0';
-    os_PutStrFull(str);
-
-    // As a progress indicator, each dot represents one plane's lightmap
-    // being updated
-    for (Plane& plane : sceneObjs) {
-      os_PutStrFull(".");
-      compute_plane_radiosity(plane);
-    }
+bool compute_radiosity() {
+  if (progress.stage == STAGE_PLANES) {
+    os_PutStrFull("Computing Plane Radiosity");
+    os_NewLine();
+    
+    // Compute radiosity light bounces
+    for (; progress.bounce < 2; progress.bounce++) {
+      // When updating saved lighting, only changes large enough to matter
+      // are bounced, and once none are left the lighting is up to date
+      if (progress.updates) {
+        bool changed = false;
+
+        for (uint8_t i = 0; i < planes.count; i++) {
+          if (plane_maps[i].drop_below(update_threshold)) changed = true;
+        }
+
+        if (!changed) break;
+      }
+
+      // Print the round number
+      char str[2];
+      str[0] = digits[progress.bounce + 1];
+      str[1] = '\0';
+      os_PutStrFull(str);
+
+      // As a progress indicator, each dot represents one plane's lightmap
+      // being updated
+#ifdef PARALLEL_RADIOSITY
+      if (interrupted()) return false;
+
+      for (uint8_t i = progress.object; i < planes.count; i++) {
+        os_PutStrFull(".");
+      }
+
+      compute_bounce_parallel();
+#else
+      for (; progress.object < planes.count; progress.object++) {
+        os_PutStrFull(".");
+        if (!compute_plane_radiosity(progress.object)) return false;
+      }
+#endif
+
+      progress.object = 0;
 
-    // After all lightmaps have been updated, replace incident illumination
-    // with outgoing illumination
-    for (Plane& plane : sceneObjs) {
-      plane.light_map.copy();
+      // After all lightmaps have been updated, replace incident illumination
+      // with outgoing illumination
+      for (uint8_t i = 0; i < planes.count; i++) {
+        plane_maps[i].copy(plane_materials[i].albedo);
+      }
     }
-  }
-  os_NewLine();
+    os_NewLine();
 
-  // Because spheres contribute less to global illumination compared to the
-  // colored walls, their illumination is only included after radiosity for
-  // planes has been fully computed
-  os_PutStrFull("Computing Sphere Radiosity");
+    // Because spheres contribute less to global illumination compared to the
+    // colored walls, their illumination is only included after radiosity for
+    // planes has been fully computed
+    for (uint8_t i = 0; i < planes.count; i++) {
+      plane_maps[i].from_bitmap(plane_materials[i].albedo);
+    }
 
-  for (Plane& plane : sceneObjs) {
-    plane.light_map.from_bitmap();
+    progress.stage = STAGE_SPHERES;
   }
 
-  for (Sphere& sphere : spheres) {
-    os_PutStrFull(".");
-    if (!sphere.reflective) {
-      compute_sphere_radiosity(sphere);
+  if (progress.stage == STAGE_SPHERES) {
+    os_PutStrFull("Computing Sphere Radiosity");
+
+    for (; progress.object < spheres.count; progress.object++) {
+      os_PutStrFull(".");
+      if (!sphere_materials[progress.object].reflective) {
+        if (interrupted()) return false;
+        compute_sphere_radiosity(progress.object);
+      }
     }
+    os_NewLine();
+
+    progress.object = 0;
+    progress.stage = STAGE_RENDER;
   }
-  os_NewLine();
-}
\ No newline at end of file
+
+  return true;
+}
@@ -30,4 +30,32 @@ struct Ray {
     
     return out;
   }
+};
+
+/* Values derived from a ray which are shared by every object it is tested
+ * against, so they only need to be computed once per ray
+ */
+struct RayContext {
+  Fixed24 dir_norm2; // |dir|^2
+
+  // 1 / |dir|^2, once it has been computed
+  Fixed24 inverse;
+  bool has_inverse;
+
+  RayContext(Ray& r) {
+    dir_norm2 = r.dir.norm_squared();
+    has_inverse = false;
+  }
+
+  /* Returns 1 / |dir|^2. This is only computed the first time it is needed,
+   * since many rays never hit anything which uses it
+   */
+  Fixed24 inv_dir_norm2() {
+    if (!has_inverse) {
+      inverse = recip(dir_norm2);
+      has_inverse = true;
+    }
+
+    return inverse;
+  }
 };
\ No newline at end of file
@@ -0,0 +1,84 @@
+#pragma once
+
+/* A rectangular region of the screen, used to track which pixels need to be
+ * rendered again after part of the scene has changed
+ *
+ * Regions are stored as half-open pixel ranges [x0, x1) x [y0, y1), and an
+ * empty region has x0 >= x1 or y0 >= y1
+ */
+
+#include <tice.h>
+
+struct Region {
+  int24_t x0;
+  int24_t y0;
+  int24_t x1;
+  int24_t y1;
+
+  // By default a region is empty, and grows as pixels are added to it
+  Region() {
+    x0 = LCD_WIDTH;
+    y0 = LCD_HEIGHT;
+    x1 = 0;
+    y1 = 0;
+  }
+
+  Region(int24_t _x0, int24_t _y0, int24_t _x1, int24_t _y1) {
+    x0 = _x0;
+    y0 = _y0;
+    x1 = _x1;
+    y1 = _y1;
+  }
+
+  bool empty() const {
+    return x0 >= x1 || y0 >= y1;
+  }
+
+  /* Expands the region to include the given pixel
+   */
+  void add(int24_t x, int24_t y) {
+    if (x     < x0) x0 = x;
+    if (y     < y0) y0 = y;
+    if (x + 1 > x1) x1 = x + 1;
+    if (y + 1 > y1) y1 = y + 1;
+  }
+
+  /* Expands the region to include another region
+   */
+  void add(const Region& r) {
+    if (r.empty()) return;
+
+    if (r.x0 < x0) x0 = r.x0;
+    if (r.y0 < y0) y0 = r.y0;
+    if (r.x1 > x1) x1 = r.x1;
+    if (r.y1 > y1) y1 = r.y1;
+  }
+
+  /* Grows the region by a border of the given number of pixels on every side
+   */
+  void pad(int24_t border) {
+    if (empty()) return;
+
+    x0 -= border;
+    y0 -= border;
+    x1 += border;
+    y1 += border;
+  }
+
+  /* Restricts the region to the screen, and rounds its corners outwards to
+   * multiples of the given render granularity
+   */
+  void clip(uint8_t grain) {
+    if (x0 < 0) x0 = 0;
+    if (y0 < 0) y0 = 0;
+    if (x1 > LCD_WIDTH)  x1 = LCD_WIDTH;
+    if (y1 > LCD_HEIGHT) y1 = LCD_HEIGHT;
+
+    x0 -= x0 % grain;
+    y0 -= y0 % grain;
+    x1 += (grain - x1 % grain) % grain;
+    y1 += (grain - y1 % grain) % grain;
+  }
+};
+
+const Region full_screen(0, 0, LCD_WIDTH, LCD_HEIGHT);
@@ -0,0 +1,75 @@
+#pragma once
+
+/* Compile time feature sets for the renderer
+ *
+ * The shading and raster loops in main are templated on one of these, so
+ * features which are switched off are compiled out entirely instead of being
+ * tested for every pixel. The final configuration is used by default, and
+ * building with -DPREVIEW gives a much faster, rougher render
+ */
+
+#include <tice.h>
+
+// The supersampling factor of the final render, which can be overridden at
+// build time, for example with -DSUPERSAMPLE=2
+#ifndef SUPERSAMPLE
+#define SUPERSAMPLE 1
+#endif
+
+// Whether the final render traces only half its pixels, which can be turned
+// on at build time with -DCHECKERBOARD=1
+#ifndef CHECKERBOARD
+#define CHECKERBOARD 0
+#endif
+
+enum DitherMode {
+  DITHER_NONE,            // Truncate each pixel to 16-bit color
+  DITHER_ERROR_DIFFUSION, // Carry rounding error along each row
+  DITHER_ORDERED          // Use a threshold based on the pixel position only
+};
+
+struct FinalConfig {
+  // Sample plane textures rather than using the flat albedo
+  static const bool textures = true;
+  // Trace reflection rays off reflective spheres
+  static const bool reflections = true;
+  // Add indirect lighting from the lightmaps computed by radiosity
+  static const bool global_illumination = true;
+
+  static const DitherMode dither = DITHER_ERROR_DIFFUSION;
+
+  // Trace pixels in a checkerboard pattern, and fill in the others from
+  // their neighbours wherever those all saw the same surface. This roughly
+  // halves render time, but is only used without supersampling
+  static const bool checkerboard = CHECKERBOARD;
+
+  // Grain controls the granularity of the output render
+  // For full resolution, each pixel is a 1x1 square, although
+  // higher granularity can speed up render time
+  static const uint8_t grain = 1;
+
+  // Supersampling allows for rendering of a scene at a resolution
+  // higher than the display hardware allows by rendering rectangular
+  // sections of pixels which fill the screen. Setting this to 2 will
+  // enable 2x2 supersampling for an output image with resolution 640 x 480
+  static const uint8_t supersample = SUPERSAMPLE;
+};
+
+struct PreviewConfig {
+  static const bool textures = false;
+  static const bool reflections = false;
+  static const bool global_illumination = false;
+
+  static const DitherMode dither = DITHER_NONE;
+
+  static const bool checkerboard = false;
+
+  static const uint8_t grain = 4;
+  static const uint8_t supersample = 1;
+};
+
+#ifdef PREVIEW
+typedef PreviewConfig RenderConfig;
+#else
+typedef FinalConfig RenderConfig;
+#endif
@@ -0,0 +1,169 @@
+#pragma once
+
+/* Treats the scene planes as the walls of a single box when they form one,
+ * as in the Cornell box. Rather than intersecting every wall and rejecting
+ * the ones hit outside their bounds, a ray is intersected with the box all
+ * at once using the slab method, which finds the wall it leaves through
+ * directly and shares one reciprocal between both walls on each axis
+ *
+ * The walls are still ordinary scene planes, so their materials, textures
+ * and lightmaps are unchanged. Sides of the box without a wall (such as the
+ * open side facing the camera) are never hit
+ */
+
+#include "vector.h"
+#include "ray.h"
+#include "plane.h"
+
+// Marks a side of the room which has no wall
+#define NO_FACE 0xFF
+
+struct Room {
+  // Whether the scene planes form a room. If not, planes are intersected
+  // individually
+  bool active;
+
+  Vec3 min;
+  Vec3 max;
+
+  // Index of the plane on each side of the room, or NO_FACE if that side is
+  // open. Sides are numbered axis * 2, plus 1 for the side at the maximum
+  // of that axis
+  uint8_t face[6];
+
+  Room() {
+    active = false;
+  }
+
+  /* Sets up the room if every plane is an inward facing wall of one 2x2x2
+   * box, with at most one plane on each side
+   */
+  void build(Planes& planes) {
+    active = false;
+
+    if (planes.count == 0) return;
+
+    min = planes.point[0];
+
+    for (uint8_t i = 0; i < planes.count; i++) {
+      Vec3& point = planes.point[i];
+      if (point.x < min.x) min.x = point.x;
+      if (point.y < min.y) min.y = point.y;
+      if (point.z < min.z) min.z = point.z;
+    }
+
+    max = min + Fixed24(2);
+
+    for (uint8_t f = 0; f < 6; f++) {
+      face[f] = NO_FACE;
+    }
+
+    for (uint8_t i = 0; i < planes.count; i++) {
+      Vec3& point = planes.point[i];
+      Vec3& normal = planes.normal[i];
+
+      uint8_t axis = planes.axis[i];
+      uint8_t u = planes.u_axis[i];
+      uint8_t v = planes.v_axis[i];
+
+      // Walls at the maximum of an axis face towards the minimum
+      bool high = normal[axis].n < 0;
+
+      if (normal[u].n || normal[v].n) return;
+      if (normal[axis] != (high ? Fixed24(-1) : Fixed24(1))) return;
+
+      // The wall must cover a whole side of the box
+      if (point[u] != min[u] || point[v] != min[v]) return;
+      if (point[axis] != (high ? max[axis] : min[axis])) return;
+
+      uint8_t f = axis * 2 + high;
+
+      if (face[f] != NO_FACE) return;
+      face[f] = i;
+    }
+
+    // Planes accept hits slightly past their edges. Moving the open sides
+    // out by the same amount keeps the walls overlapping the opening as
+    // they would if each plane were tested on its own
+    for (uint8_t axis = 0; axis < 3; axis++) {
+      if (face[axis * 2]     == NO_FACE) min[axis] -= Fixed24(.01f);
+      if (face[axis * 2 + 1] == NO_FACE) max[axis] += Fixed24(.01f);
+    }
+
+    active = true;
+  }
+
+  /* Compute the t parameter where this ray hits a wall of the room, and the
+   * index of that plane. t < 0 implies no intersection
+   *
+   * Rays starting inside the room hit the wall they leave through. Rays
+   * starting outside hit the first wall they cross, or if they enter
+   * through an open side, the wall they leave through
+   */
+  Fixed24 ray_intersect(Ray& r, uint8_t& index) {
+    Fixed24 t_near(-2000);
+    Fixed24 t_far(2000);
+    uint8_t near_side = NO_FACE;
+    uint8_t far_side = NO_FACE;
+
+    for (uint8_t axis = 0; axis < 3; axis++) {
+      Fixed24 d = r.dir[axis];
+      Fixed24 lo = min[axis] - r.origin[axis];
+      Fixed24 hi = max[axis] - r.origin[axis];
+
+      // Rays (nearly) parallel to a pair of walls never cross them, so they
+      // only pass through the room if they start between them. The
+      // reciprocal of such small values could not be represented anyway
+      if (d.n >= -2 && d.n <= 2) {
+        if (lo.n > 0 || hi.n < 0) return Fixed24(-1);
+        continue;
+      }
+
+      Fixed24 inv = recip(d);
+      Fixed24 t_lo = lo * inv;
+      Fixed24 t_hi = hi * inv;
+
+      // Rays heading towards the maximum of this axis enter through the low
+      // side and leave through the high side, and the reverse otherwise
+      bool forward = d.n > 0;
+
+      Fixed24 t_enter = forward ? t_lo : t_hi;
+      Fixed24 t_exit  = forward ? t_hi : t_lo;
+
+      uint8_t enter_side = axis * 2 + !forward;
+      uint8_t exit_side  = axis * 2 + forward;
+
+      // Where the ray crosses an edge of the box, ties go to the lowest plane
+      // index, as they would when testing the planes in order
+      if (t_enter > t_near || (t_enter.n == t_near.n && plane(enter_side) < plane(near_side))) {
+        t_near = t_enter;
+        near_side = enter_side;
+      }
+
+      if (t_exit < t_far || (t_exit.n == t_far.n && plane(exit_side) < plane(far_side))) {
+        t_far = t_exit;
+        far_side = exit_side;
+      }
+    }
+
+    // The ray misses the box entirely
+    if (t_near > t_far) return Fixed24(-1);
+
+    if (t_near.n > 1 && plane(near_side) != NO_FACE) {
+      index = plane(near_side);
+      return t_near;
+    }
+
+    if (plane(far_side) == NO_FACE) return Fixed24(-1);
+
+    index = plane(far_side);
+    return t_far;
+  }
+
+  /* Returns the index of the plane on the given side of the room, or NO_FACE
+   * if there isn't one
+   */
+  uint8_t plane(uint8_t side) {
+    return side == NO_FACE ? NO_FACE : face[side];
+  }
+};
@@ -13,26 +13,147 @@
  * to keep this more scene specific in the name of speed.
  */
 
+#include <tice.h>
 #include "vector.h"
 #include "plane.h"
 #include "sphere.h"
+#include "texture.h"
+#include "lightmap.h"
+#include "irradiance.h"
+#include "room.h"
 
-Plane sceneObjs[5] = {
-  Plane(Vec3(-1, -1,  2), Vec3( 0,  1,  0), fromRGB(29, 24, 18), &wood_tex),
-  Plane(Vec3(-1,  1,  2), Vec3( 0, -1,  0), fromRGB(24, 24, 24),   nullptr),
-  Plane(Vec3(-1, -1,  2), Vec3( 1,  0,  0), fromRGB(24,  9,  9),   nullptr),
-  Plane(Vec3( 1, -1,  2), Vec3(-1,  0,  0), fromRGB( 9,  9, 26),   nullptr),
-  Plane(Vec3(-1, -1,  4), Vec3( 0,  0, -1), fromRGB(24, 24, 24),   nullptr)
-};
+// Values needed for intersection, touched for every ray
+Planes planes;
+Spheres spheres;
+
+// Shading data, only touched for the closest hit of each ray
+PlaneMaterial plane_materials[MAX_PLANES];
+SphereMaterial sphere_materials[MAX_SPHERES];
+
+LightMap plane_maps[MAX_PLANES];
+SphereIrradiance sphere_irradiance[MAX_SPHERES];
+
+// Set up when the planes form the walls of a box, to intersect them together
+Room room;
+
+#define MAX_LIGHTS 4
 
-Sphere spheres[2] = {
-  Sphere(Vec3(0, 0, 3), .4f, nullptr, true),
-  Sphere(Vec3(0, 0, 3), .4f, nullptr, false)
+// The point lights in the scene. Intensities scale the light from each one,
+// and must be below MAX_LIGHT_INTENSITY so shading can use Fixed16
+#define MAX_LIGHT_INTENSITY 8
+
+struct Lights {
+  uint8_t count;
+
+  Vec3 point[MAX_LIGHTS];
+  Fixed24 intensity[MAX_LIGHTS];
 };
 
-// Scenes currently only support a single point light source, maybe that 
-// should change?
-Vec3 light(0, 1, 3);
+Lights lights;
+
+Vec3 cam_origin(0, 0, 0);
+
+// Textures which scene materials can refer to by index, and the AppVars
+// they are loaded from. Index 0 is reserved for untextured materials
+#define NUM_TEXTURES 3
+
+Texture scene_textures[NUM_TEXTURES];
+const char* texture_names[NUM_TEXTURES] = { nullptr, "RTTEX1", "RTTEX2" };
+
+/* Points every texture at its AppVar. This must be done before the scene is
+ * set up, and again after any variable is archived, since that may move them
+ */
+void load_textures() {
+  for (uint8_t i = 1; i < NUM_TEXTURES; i++) {
+    scene_textures[i].load(texture_names[i]);
+  }
+}
+
+/* Closes the AppVars of all textures, which are kept open while in use
+ */
+void unload_textures() {
+  for (uint8_t i = 1; i < NUM_TEXTURES; i++) {
+    scene_textures[i].unload();
+  }
+}
+
+/* Returns the texture with the given index, or nullptr if there is none or it
+ * could not be loaded, in which case the flat albedo is used. A missing
+ * texture is reported the first time it is asked for
+ */
+Texture* scene_texture(uint8_t index) {
+  static bool reported[NUM_TEXTURES];
+
+  if (index == 0) return nullptr;
+
+  if (index >= NUM_TEXTURES) {
+    os_PutStrFull("Unknown texture index");
+    os_NewLine();
+    return nullptr;
+  }
+
+  Texture& texture = scene_textures[index];
+  if (texture.bitmap) return &texture;
+
+  if (!reported[index]) {
+    reported[index] = true;
+
+    os_PutStrFull("Missing texture ");
+    os_PutStrFull(texture_names[index]);
+    os_NewLine();
+  }
+
+  return nullptr;
+}
+
+/* Fills in both the intersection and shading data of a scene plane
+ */
+void set_plane(uint8_t i, Vec3 point, Vec3 normal, Color color, Texture* texture) {
+  planes.set(i, point, normal);
+  plane_materials[i].albedo = Spectrum(color);
+  plane_materials[i].texture = texture;
+}
+
+/* Sets the position and intensity of a scene light
+ */
+void set_light(uint8_t i, Vec3 point, Fixed24 intensity) {
+  lights.point[i] = point;
+  lights.intensity[i] = intensity;
+}
+
+/* Fills in both the intersection and shading data of a scene sphere
+ */
+void set_sphere(uint8_t i, Vec3 point, Fixed24 radius, Texture* texture, bool reflective) {
+  spheres.set(i, point, radius);
+  sphere_materials[i].reflective = reflective;
+  sphere_materials[i].texture = texture;
+}
+
+/* Sets up the built in Cornell Box scene, used whenever no scene file is 
+ * available
+ */
+void default_scene() {
+  planes.count = 5;
+  set_plane(0, Vec3(-1, -1,  2), Vec3( 0,  1,  0), fromRGB(29, 24, 18), scene_texture(1));
+  set_plane(1, Vec3(-1,  1,  2), Vec3( 0, -1,  0), fromRGB(24, 24, 24),   nullptr);
+  set_plane(2, Vec3(-1, -1,  2), Vec3( 1,  0,  0), fromRGB(24,  9,  9),   nullptr);
+  set_plane(3, Vec3( 1, -1,  2), Vec3(-1,  0,  0), fromRGB( 9,  9, 26),   nullptr);
+  set_plane(4, Vec3(-1, -1,  4), Vec3( 0,  0, -1), fromRGB(24, 24, 24),   nullptr);
+
+  spheres.count = 2;
+  set_sphere(0, Vec3(-.33f, -.6f, 3.052f), Fixed24(.4f), nullptr, true);
+  set_sphere(1, Vec3( .43f, -.6f, 2.43f ), Fixed24(.4f), nullptr, false);
+
+  // A few altername scene parameters which can be substituted in for
+  // different scene configurations
+  //set_light(0, Vec3(0.5f, -0.9f, 3.5f), Fixed24(1));
+  //cam_origin = Vec3(-0.5f, -0.5f, 1.5f);
+
+  lights.count = 1;
+  set_light(0, Vec3(0.0f, 0.5f, 3.0f), Fixed24(1));
+
+  cam_origin = Vec3(0, 0, 0);
+}
 
 /* Returns true if the ray intersects any sphere. False otherwise.
  * 
@@ -40,8 +161,10 @@ Vec3 light(0, 1, 3);
  * shadows
  */
 bool compute_shadow(Ray& ray) {
-  for (Sphere& sphere : spheres) {
-    if (sphere.shadow_intersect(ray)) return true;
+  RayContext ctx(ray);
+
+  for (uint8_t i = 0; i < spheres.count; i++) {
+    if (spheres.shadow_intersect(i, ray, ctx)) return true;
   }
 
   return false;
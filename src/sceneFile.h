@@ -0,0 +1,208 @@
+#pragma once
+
+/* Loads scenes at runtime from a compact binary format, so the scene can be
+ * changed without rebuilding the program. Scene files are produced on a
+ * computer by convertScene.py
+ *
+ * On the calculator the scene is read in place from its (usually archived)
+ * AppVar, so the file itself is never copied into RAM. Only the handful of
+ * values each object needs for intersection end up in the scene arrays,
+ * alongside the lightmaps which have to live in RAM anyway
+ *
+ * All values are little endian, and Fixed24 values are stored as 3 byte
+ * 12.12 fixed point numbers. The layout is
+ *
+ *  Header
+ *    char[4]  "RTSC"
+ *    uint8    version
+ *    uint8    number of materials
+ *    uint8    number of planes
+ *    uint8    number of spheres
+ *    uint8    number of lights
+ *    Vec3     camera position
+ *
+ *  Materials, each
+ *    uint16   color (as in fromRGB)
+ *    uint8    texture index into scene_textures (0 for none, 1 for RTTEX1, ...)
+ *    uint8    flags (bit 0 is set for reflective materials)
+ *
+ *  Planes, each (a 2x2 square starting from point)
+ *    Vec3     point
+ *    Vec3     normal (a unit axis, +-x, +-y or +-z)
+ *    uint8    material index
+ *
+ *  Spheres, each
+ *    Vec3     center
+ *    Fixed24  radius (above 0)
+ *    uint8    material index
+ *
+ *  Lights, each
+ *    Vec3     position
+ *    Fixed24  intensity (below MAX_LIGHT_INTENSITY)
+ *
+ * Sphere shading does not currently use the material color
+ */
+
+#include "scene.h"
+#include "appvar.h"
+
+#define SCENE_VERSION 2
+
+#define SCENE_HEADER_SIZE   18
+#define SCENE_MATERIAL_SIZE 4
+#define SCENE_PLANE_SIZE    19
+#define SCENE_SPHERE_SIZE   13
+#define SCENE_LIGHT_SIZE    12
+
+#define MATERIAL_REFLECTIVE 1
+
+/* Reads values sequentially from a scene file in memory
+ */
+struct SceneReader {
+  const uint8_t* data;
+
+  SceneReader(const uint8_t* _data) {
+    data = _data;
+  }
+
+  uint8_t byte() {
+    return *data++;
+  }
+
+  Fixed24 fixed() {
+    Fixed24 out;
+
+    // Assemble the value with sign extension from the top byte
+    out.n = (int24_t)(data[0] | (data[1] << 8)) | ((int24_t)(int8_t)data[2] << 16);
+    data += 3;
+
+    return out;
+  }
+
+  Vec3 vec() {
+    Fixed24 x = fixed();
+    Fixed24 y = fixed();
+    Fixed24 z = fixed();
+
+    return Vec3(x, y, z);
+  }
+};
+
+/* Looks up the texture for a material, ignoring indices which are out of
+ * range
+ */
+Texture* material_texture(const uint8_t* material) {
+  return scene_texture(material[2]);
+}
+
+/* Returns whether a plane normal points along one axis with unit length,
+ * which plane intersection and texturing rely on
+ */
+bool axis_normal(Vec3& normal) {
+  uint8_t units = 0;
+  Fixed24 components[3] = { normal.x, normal.y, normal.z };
+
+  for (uint8_t i = 0; i < 3; i++) {
+    if (components[i].n == Fixed24(1).n || components[i].n == Fixed24(-1).n) units++;
+    else if (components[i].n != 0) return false;
+  }
+
+  return units == 1;
+}
+
+/* Reads a scene file in memory into the scene arrays. Returns false if it is
+ * invalid, including when a value is outside the range the rest of the
+ * program relies on
+ */
+bool read_scene(const uint8_t* data, size_t size) {
+  if (!data || size < SCENE_HEADER_SIZE) return false;
+
+  SceneReader reader(data);
+
+  if (reader.byte() != 'R' || reader.byte() != 'T' ||
+      reader.byte() != 'S' || reader.byte() != 'C') return false;
+
+  if (reader.byte() != SCENE_VERSION) return false;
+
+  uint8_t material_count = reader.byte();
+  uint8_t plane_count    = reader.byte();
+  uint8_t sphere_count   = reader.byte();
+  uint8_t light_count    = reader.byte();
+
+  if (plane_count > MAX_PLANES || sphere_count > MAX_SPHERES ||
+      light_count > MAX_LIGHTS) return false;
+
+  size_t expected = SCENE_HEADER_SIZE +
+                    material_count * SCENE_MATERIAL_SIZE +
+                    plane_count    * SCENE_PLANE_SIZE +
+                    sphere_count   * SCENE_SPHERE_SIZE +
+                    light_count    * SCENE_LIGHT_SIZE;
+
+  if (size < expected) return false;
+
+  cam_origin = reader.vec();
+
+  // Materials are referred to in place by the objects which follow
+  const uint8_t* material_table = reader.data;
+  reader.data += material_count * SCENE_MATERIAL_SIZE;
+
+  planes.count = plane_count;
+
+  for (uint8_t i = 0; i < planes.count; i++) {
+    Vec3 point = reader.vec();
+    Vec3 normal = reader.vec();
+    uint8_t index = reader.byte();
+
+    if (index >= material_count || !axis_normal(normal)) return false;
+
+    const uint8_t* material = material_table + index * SCENE_MATERIAL_SIZE;
+    Color color = material[0] | (material[1] << 8);
+
+    set_plane(i, point, normal, color, material_texture(material));
+  }
+
+  spheres.count = sphere_count;
+
+  for (uint8_t i = 0; i < spheres.count; i++) {
+    Vec3 center = reader.vec();
+    Fixed24 radius = reader.fixed();
+    uint8_t index = reader.byte();
+
+    // Intersection divides by the radius
+    if (index >= material_count || radius.n <= 0) return false;
+
+    const uint8_t* material = material_table + index * SCENE_MATERIAL_SIZE;
+    bool reflective = material[3] & MATERIAL_REFLECTIVE;
+
+    set_sphere(i, center, radius, material_texture(material), reflective);
+  }
+
+  lights.count = light_count;
+
+  for (uint8_t i = 0; i < lights.count; i++) {
+    Vec3 point = reader.vec();
+    Fixed24 intensity = reader.fixed();
+
+    if (intensity.n < 0 || intensity >= Fixed24(MAX_LIGHT_INTENSITY)) return false;
+
+    set_light(i, point, intensity);
+  }
+
+  return true;
+}
+
+/* Loads the named scene file into the scene arrays. Returns false if the file
+ * is missing or invalid, in which case the scene may be partially loaded and
+ * should be replaced with the default scene
+ */
+bool load_scene(const char* name) {
+  var_t var = open_var(name, "r");
+  if (!var) return false;
+
+  size_t size = var_size(var);
+  bool ok = read_scene(var_data(var), size);
+
+  close_var(var);
+
+  return ok;
+}
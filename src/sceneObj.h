@@ -1,8 +1,10 @@
 #pragma once
 
-/* A generic container for both types of scene objects (planes and spheres)
+/* A generic reference to either type of scene object (planes and spheres)
  *
- * This is used in main to reuse shading code between both object types
+ * This is used in main to reuse shading code between both object types.
+ * Objects are referred to by their index into the scene arrays, so hit
+ * records stay small
  */
 
 #include "plane.h"
@@ -11,26 +13,16 @@
 enum objType { PLANE, SPHERE };
 
 struct SceneObj {
-  // This should probably be done as a union type
-  Plane *plane;
-  Sphere *sphere;
   objType type;
+  uint8_t index;
 
   SceneObj(void) {
-    plane = nullptr;
-    sphere = nullptr;
     type = PLANE;
+    index = 0;
   }
 
-  SceneObj(Plane* _plane) {
-    plane = _plane;
-    sphere = nullptr;
-    type = PLANE;
-  }
-
-  SceneObj(Sphere* _sphere) {
-    plane = nullptr;
-    sphere = _sphere;
-    type = SPHERE;
+  SceneObj(objType _type, uint8_t _index) {
+    type = _type;
+    index = _index;
   }
 };
\ No newline at end of file
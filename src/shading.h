@@ -0,0 +1,244 @@
+#pragma once
+
+/* Shades rays cast into the scene. This is shared by the calculator program
+ * in main.cpp, which casts them for each pixel on screen, and the offline
+ * renderer in host/offline.cpp
+ */
+
+#include <tice.h>
+
+#include "fixedpoint.h"
+#include "vector.h"
+#include "fixed16.h"
+#include "ray.h"
+#include "sceneObj.h"
+#include "spectrum.h"
+#include "scene.h"
+#include "profiler.h"
+#include "visibility.h"
+
+// The position of the closest hit of the last ray traced
+Vec3 hit_pos;
+
+// Scales the color of each ray. Reflections are scaled by this once for the
+// ray off the sphere and again for the ray which hit it
+Fixed24 exposure(2.0f);
+
+// The range of columns [span_start, span_end) which each sphere may cover on
+// the row being rendered, and the column of the current camera ray. Camera
+// rays outside a sphere's span skip it without any intersection math
+int24_t span_start[MAX_SPHERES];
+int24_t span_end[MAX_SPHERES];
+int24_t ray_column = 0;
+
+// Identifies the surface a ray was shaded on, after following any
+// reflections, and which lights that point was shadowed from. Used by
+// checkerboard rendering to tell where neighbouring pixels can be blended
+#define ID_REFLECTED 0x20
+#define ID_SPHERE 0x40
+#define ID_SHADOW_SHIFT 8
+#define ID_NONE 0xFFFF
+
+uint16_t hit_id = ID_NONE;
+
+// Passed as the mirror of rays which were not reflected off a sphere
+#define NO_MIRROR 0xFF
+
+template <class Config, bool from_cam>
+Spectrum compute_ray(Ray& ray, uint8_t mirror = NO_MIRROR);
+
+/* Given a ray and hit information, computes the shading of the provided
+ * object at the hit point
+ */
+template <class Config>
+Spectrum compute_shading(Ray& ray, Vec3 &hit_pos, SceneObj &obj) {
+  Vec3 normal;
+  Fixed24 u, v;
+  Spectrum color;
+  uint8_t i = obj.index;
+  
+  switch (obj.type) {
+  case PLANE: {
+    PlaneMaterial& material = plane_materials[i];
+    normal = planes.normal[i];
+
+    // Find the texture coordinates of the hit
+    planes.uv(i, hit_pos, u, v);
+
+    // Lighting is added up as irradiance, before the albedo is applied
+    if (Config::global_illumination) {
+      color = plane_maps[i].sample(u, v);
+    }
+
+    Fixed24 direct;
+
+    // Look up which lights are known to reach this part of the plane
+    uint8_t tx = Visibility::texel(u);
+    uint8_t ty = Visibility::texel(v);
+    uint8_t lit = visibility.lit[i][tx][ty];
+    uint8_t boundary = visibility.boundary[i][tx][ty];
+    uint8_t shadows = 0;
+
+    for (uint8_t l = 0; l < lights.count; l++) {
+      uint8_t bit = 1 << l;
+      Vec3 offset = lights.point[l] - hit_pos;
+
+      // Shadow rays are only needed near the edges of shadows
+      if (boundary & bit) {
+        Ray shadow_ray(hit_pos, offset);
+
+        if (compute_shadow(shadow_ray)) {
+          shadows |= bit;
+          continue;
+        }
+      }
+      else if (!(lit & bit)) {
+        shadows |= bit;
+        continue;
+      }
+
+      // Compute the lambertian attenuation of the lighting at this sample point
+      Fixed24 attenuation = dot16(normal, offset);
+      Fixed24 dist2 = offset.norm_squared();
+
+      attenuation = clamp01(div(attenuation, sqrt(dist2) * dist2));
+
+      // Attenuations are within [0, 1] and intensities below 8, so reduced
+      // range multiplies are exact here
+      direct += mul16(attenuation, lights.intensity[l]);
+    }
+
+    color += Spectrum(direct);
+
+    if (Config::checkerboard) {
+      hit_id = i | (shadows << ID_SHADOW_SHIFT);
+    }
+
+    // If this object has a texture, sample the precise albedo from it,
+    // otherwise use the flat albedo
+    if (Config::textures && material.texture != nullptr) {
+      return color * Spectrum(material.texture->sample(u, v));
+    }
+
+    return color * material.albedo;
+  }
+
+  case SPHERE: {
+    normal = (hit_pos - spheres.point[i]) * spheres.inv_radius[i];
+
+    if (Config::reflections && sphere_materials[i].reflective) {
+      Vec3 reflection = ray.dir - (normal * (Fixed24(2) * dot16(normal, ray.dir)));
+
+      Ray reflect_ray(hit_pos + (reflection * Fixed24(0.01f)), reflection);
+
+      Spectrum reflected = compute_ray<Config, false>(reflect_ray, i);
+
+      if (Config::checkerboard) {
+        hit_id |= ID_REFLECTED;
+      }
+
+      return reflected;
+    }
+
+    if (Config::checkerboard) {
+      hit_id = i | ID_SPHERE;
+    }
+
+    if (Config::global_illumination) {
+      color = sphere_irradiance[i].sample(normal);
+    }
+
+    for (uint8_t l = 0; l < lights.count; l++) {
+      Vec3 offset = lights.point[l] - hit_pos;
+
+      // Compute the lambertian attenuation of the lighting at this sample point
+      Fixed24 attenuation = dot16(normal, offset);
+      Fixed24 dist2 = offset.norm_squared();
+
+      attenuation = clamp01(div(attenuation, sqrt(dist2) * dist2));
+
+      color += Spectrum(mul16(attenuation, lights.intensity[l]));
+    }
+
+    return color;
+  }
+  }
+
+  return color;
+}
+
+/* Computes the scene color for a given ray
+ *
+ * Rays from the camera use the faster intersection tests which rely on the
+ * camera position registered with each object. Rays reflected off a sphere
+ * pass its index as the mirror, which they skip
+ */
+template <class Config, bool from_cam>
+Spectrum compute_ray(Ray &ray, uint8_t mirror) {
+  Spectrum color(Fixed24(0));
+
+  if (Config::checkerboard) {
+    hit_id = ID_NONE;
+  }
+  
+  PROFILE_BEGIN(PROF_INTERSECT);
+
+  // Start the culling depth at 2000 units (practically infinity for FP24)
+  Fixed24 min_t(2000);
+  SceneObj closestObj;
+
+  // Find the closest hit along our ray
+  if (room.active) {
+    uint8_t i;
+    Fixed24 t = room.ray_intersect(ray, i);
+
+    if (t.n > 1 && t < min_t) {
+      closestObj = SceneObj(PLANE, i);
+      min_t = t;
+    }
+  }
+  else {
+    for (uint8_t i = 0; i < planes.count; i++) {
+      Fixed24 t = from_cam ? planes.ray_intersect_fast(i, ray) : planes.ray_intersect(i, ray);
+
+      // If we hit closer to the camera, keep this depth
+      if (t.n > 1 && t < min_t) {
+        closestObj = SceneObj(PLANE, i);
+        min_t = t;
+      }
+    }
+  }
+
+  // Check if we hit any spheres
+  RayContext ctx(ray);
+
+  for (uint8_t i = 0; i < spheres.count; i++) {
+    if (from_cam && (ray_column < span_start[i] || ray_column >= span_end[i])) continue;
+
+    // Rays leaving a sphere can never hit it again
+    if (i == mirror) continue;
+
+    Fixed24 t = from_cam ? spheres.ray_intersect_fast(i, ray, ctx) : spheres.ray_intersect(i, ray, ctx);
+
+    // If we hit closer to the camera, keep this depth
+    if (t.n > 1 && t < min_t) {
+      closestObj = SceneObj(SPHERE, i);
+      min_t = t;
+    }
+  }
+
+  PROFILE_END(PROF_INTERSECT);
+
+  // If we hit an object, compute the color of that object
+  if (min_t < Fixed24(2000)) {
+    PROFILE_BEGIN(PROF_SHADING);
+
+    hit_pos = ray.at(min_t);
+
+    color = compute_shading<Config>(ray, hit_pos, closestObj);
+
+    PROFILE_END(PROF_SHADING);
+  }
+
+  return color * exposure;
+}
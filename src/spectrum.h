@@ -312,6 +312,7 @@ uint8_t gamma(Fixed24 x) {
   while (low < high) {
     int24_t mid = (low + high) >> 1;
 
+    COUNT_OP(OP_LUT);
     if (gamma_LUT[mid] == x.n) return mid;
 
     if (gamma_LUT[mid] > x.n) {
@@ -348,6 +349,7 @@ struct Spectrum {
     int8_t _g = (c >>  6) & COLOR_MASK;
     int8_t _b =  c        & COLOR_MASK;
 
+    COUNT_OPS_N(OP_LUT, 3);
     r.n = degamma_LUT[_r];
     g.n = degamma_LUT[_g];
     b.n = degamma_LUT[_b];
@@ -388,11 +390,23 @@ struct Spectrum {
   }
 
   Spectrum operator*(Fixed24 s) const {
-    Spectrum out;
+    Spectrum out = *this;
     
-    out.r = r * s;
-    out.g = g * s;
-    out.b = b * s;
+    COUNT_OPS_N(OP_MUL, 3);
+    fp_scale3(&out.r.n, s.n);
+
+    return out;
+  }
+
+  /* Multiplies each component separately, as when light is reflected off a
+   * surface of this color
+   */
+  Spectrum operator*(Spectrum s) const {
+    Spectrum out;
+
+    out.r = r * s.r;
+    out.g = g * s.g;
+    out.b = b * s.b;
 
     return out;
   }
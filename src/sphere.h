@@ -6,102 +6,170 @@
  * Spheres can register the ray origin (camera position) before
  * computing intersections to avoid redundant computations when
  * the camera position is constant
+ *
+ * As with planes, all spheres in the scene are stored together as a
+ * structure of arrays holding only what intersection needs. Shading data
+ * lives in separate tables indexed the same way
  */
 
 #include <math.h>
 #include "fixedpoint.h"
 #include "vector.h"
 #include "ray.h"
+#include "texture.h"
 
-struct Sphere {
-  Vec3 point;
-  Fixed24 radius;
-  bool reflective;
+// Capacity of the scene. Every ray is tested against every sphere, so this
+// is kept small
+#define MAX_SPHERES 4
 
-  Texture* texture;
-  LightMap light_map;
+// How far camera_span raises the discriminant to cover rounding error in the
+// fixed point intersection
+#define SPAN_MARGIN 0.05f
+
+struct Spheres {
+  uint8_t count;
+
+  Vec3 point[MAX_SPHERES];
+  Fixed24 radius[MAX_SPHERES];
+  Fixed24 inv_radius[MAX_SPHERES];
 
   // Precomputed values to speed up the math
-  Vec3 offset;
-  Fixed24 c;
+  Vec3 offset[MAX_SPHERES];
+  Fixed24 c[MAX_SPHERES];
 
-  Sphere(Vec3 _point, float _radius, Texture* _texture, bool _reflective) {
-    point  = _point;
-    radius = Fixed24(_radius);
-    reflective = _reflective;
+  Spheres() {
+    count = 0;
+  }
 
-    texture = _texture;
+  void set(uint8_t i, Vec3 _point, Fixed24 _radius) {
+    point[i]  = _point;
+    radius[i] = _radius;
+    inv_radius[i] = recip(_radius);
   }
 
   /* Precompute some of the ray intersection math which is not dependent on
    * ray direction. This only needs updated whenever the camera position
    * is changed
    */
-  void register_camera(Vec3& origin) {
-    offset = origin - point;
-    c = offset.norm_squared() - sqr(radius);
+  void register_camera(uint8_t i, Vec3& origin) {
+    offset[i] = origin - point[i];
+    c[i] = offset[i].norm_squared() - sqr(radius[i]);
   }
 
-  /* Compute the t parameter where this ray intersects with the sphere.
+  /* Compute the t parameter where this ray intersects with sphere i.
    * t < 0 implies no intersection
    *
    * Requires register_camera to have been called earlier with the correct
    * camera position.
    */
-  Fixed24 ray_intersect_fast(Ray& ray) {
+  Fixed24 ray_intersect_fast(uint8_t i, Ray& ray, RayContext& ctx) {
     // Compute the sphere intersection
-    Fixed24 a = ray.dir.norm_squared();
-    Fixed24 b2 = dot(offset, ray.dir);
+    Fixed24 b2 = dot(offset[i], ray.dir);
 
     // Compute the discriminant
-    Fixed24 d = sqr(b2) - (a * c);
+    Fixed24 d = sqr(b2) - (ctx.dir_norm2 * c[i]);
 
     // If we don't intersect, just return any negative number
     if (d.n < 0) return Fixed24(-1);
 
     // Compute the quadratic formula result for t
-    return div(-b2 - sqrt(d), a);
+    return (-b2 - sqrt(d)) * ctx.inv_dir_norm2();
   }
 
-  /* Compute the t parameter where this ray intersects with the sphere.
+  /* Finds the range of x directions [lo, hi] of camera rays with the given
+   * y direction (and a z direction of 1) which may hit sphere i. Along a row
+   * the discriminant is a quadratic in x, so its roots bound the span. It is
+   * raised by SPAN_MARGIN first so rounding in ray_intersect_fast can never
+   * find a hit outside the span. The span is empty if lo > hi
+   *
+   * Returns false if the span is unbounded (when the camera is inside the
+   * sphere), in which case every ray must be tested
+   *
+   * Requires register_camera to have been called earlier with the correct
+   * camera position.
+   */
+  bool camera_span(uint8_t i, Fixed24 dir_y, float& lo, float& hi) {
+    const float scale = 1.0f / (1 << POINT);
+
+    float ox = offset[i].x.n * scale;
+    float oy = offset[i].y.n * scale;
+    float oz = offset[i].z.n * scale;
+    float cf = c[i].n * scale;
+    float dy = dir_y.n * scale;
+
+    // b/2 = ox * x + k, and the discriminant is (b/2)^2 - (x^2 + dy^2 + 1) * c
+    float k = oy * dy + oz;
+
+    float qa = ox * ox - cf;
+    float qb = 2 * ox * k;
+    float qc = k * k - cf * (dy * dy + 1) + SPAN_MARGIN;
+
+    // The discriminant only falls off on both sides if it opens downwards
+    if (qa >= 0) return false;
+
+    float disc = qb * qb - 4 * qa * qc;
+
+    if (disc < 0) {
+      lo = 1;
+      hi = 0;
+      return true;
+    }
+
+    float root = sqrt(disc);
+
+    // qa is negative, so this puts the roots in order
+    lo = (-qb + root) / (2 * qa);
+    hi = (-qb - root) / (2 * qa);
+    return true;
+  }
+
+  /* Compute the t parameter where this ray intersects with sphere i.
    * t < 0 implies no intersection
    *
    * This implementation does not rely on precomputed values, thus it
    * can be used for any ray r, although it will be somewhat slower
    */
-  Fixed24 ray_intersect(Ray& ray) {
-    Vec3 _offset = ray.origin - point;
+  Fixed24 ray_intersect(uint8_t i, Ray& ray, RayContext& ctx) {
+    Vec3 _offset = ray.origin - point[i];
     // Compute the sphere intersection
-    Fixed24 a = ray.dir.norm_squared();
     Fixed24 b2 = dot(_offset, ray.dir);
-    Fixed24 _c = _offset.norm_squared() - sqr(radius);
+    Fixed24 _c = _offset.norm_squared() - sqr(radius[i]);
 
     // Compute the discriminant
-    Fixed24 d = sqr(b2) - (a * _c);
+    Fixed24 d = sqr(b2) - (ctx.dir_norm2 * _c);
 
     // If we don't intersect, just return any negative number
     if (d < Fixed24(0)) return Fixed24(-1);
 
     // Compute the quadratic formula result for t
-    return div(-b2 - sqrt(d), a);
+    return (-b2 - sqrt(d)) * ctx.inv_dir_norm2();
   }
 
-  /* Tests if the ray intersects the sphere at any point. This fails on cases
-   * with intersections before the ray origin, but it is a lot faster to compute
+  /* Tests if the ray intersects sphere i at any point. This fails on cases
+   * with intersections before the ray origin, but it is a lot faster to
+   * compute
    */
-  bool shadow_intersect(Ray& ray) {
-    Vec3 _offset = ray.origin - point;
+  bool shadow_intersect(uint8_t i, Ray& ray, RayContext& ctx) {
+    Vec3 _offset = ray.origin - point[i];
     // Compute the sphere intersection
-    Fixed24 a = ray.dir.norm_squared();
+    Fixed24 a = ctx.dir_norm2;
     Fixed24 b2 = dot(_offset, ray.dir);
-    Fixed24 _c = _offset.norm_squared() - sqr(radius);
+    Fixed24 _c = _offset.norm_squared() - sqr(radius[i]);
 
     // Compute the discriminant
     Fixed24 d = sqr(b2) - (a * _c);
 
     if (d < Fixed24(0)) return false;
-    
+
     // Check that the intersection point has t < 1 (simplified)
     return -b2 - sqrt(d) < a;
   }
+};
+
+/* Shading properties of a sphere, only looked at once a ray is known to have
+ * hit it
+ */
+struct SphereMaterial {
+  bool reflective;
+  Texture* texture;
 };
\ No newline at end of file
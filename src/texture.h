@@ -2,72 +2,111 @@
 
 /* Defines the Texture type for textured objects, and provides functions
  * to sample textures on both planes and spheres
+ *
+ * Texels are not part of the program. Each texture is stored in an AppVar
+ * written by convertTex.py, and sampled where it lies, so a texture in the
+ * archive is read straight from flash without taking up any RAM
+ *
+ * The AppVar holds
+ *    char[4]  "RTTX"
+ *    uint8    format version (TEX_VERSION)
+ *    uint8    log2 of the width and height
+ *    uint16   colors (as in fromRGB), row by row
  */
 
 #include "color.h"
 #include "vector.h"
+#include "appvar.h"
 
-// Textures must be square with dimensions of some power of 2
-// Here, the texture is configured to be 128 x 128
-#define TEX_BITS 7
-#define TEX_MASK ((1 << TEX_BITS) - 1)
-#define TEX_HALF (1 << (TEX_BITS - 1))
-#define TEX_SIZE (1 << TEX_BITS)
+// Textures must be square with dimensions of some power of 2, up to 128 x 128
+// since anything larger would not fit in an AppVar
+#define TEX_MAX_BITS 7
+#define TEX_VERSION 1
+#define TEX_HEADER_SIZE 6
 
 struct Texture {
-  Color bitmap[TEX_SIZE][TEX_SIZE];
+  // The texels, row by row, or nullptr if the texture is not loaded
+  const Color* bitmap;
+  uint8_t bits;
 
-  /* Samples the texture on a plane with origin at (0, 0, 0)
+  // The AppVar holding the texels, which is kept open while they are in use
+  var_t var;
+
+  Texture() {
+    bitmap = nullptr;
+    bits = 0;
+    var = 0;
+  }
+
+  /* Points this texture at the texels in the named AppVar. Returns false,
+   * leaving the texture unloaded, if there is no valid texture there
+   *
+   * Archiving any variable may move the texels, so this must be done again
+   * afterwards
    */
-  Color sample(Vec3& hit_pos, Vec3& normal) {
-    // Compute the texture color at this floor position
-    int24_t tile_x = hit_pos.x.floor(LERP_BITS + TEX_BITS - 1) - LERP_HALF;
-    int24_t tile_y = hit_pos.y.floor(LERP_BITS + TEX_BITS - 1) - LERP_HALF;
-    int24_t tile_z = hit_pos.z.floor(LERP_BITS + TEX_BITS - 1) - LERP_HALF;
+  bool load(const char* name) {
+    unload();
 
-    int24_t tex_x = 0;
-    int24_t tex_y = 0;
-    int8_t sub_x = 0;
-    int8_t sub_y = 0;
+    var = open_var(name, "r");
+    if (!var) return false;
 
-    if (normal.x.n) {
-      tex_x = (tile_z >> LERP_BITS);
-      tex_y = (tile_y >> LERP_BITS);
+    size_t size = var_size(var);
+    const uint8_t* data = var_data(var);
 
-      sub_x = tile_z & LERP_MASK;
-      sub_y = tile_y & LERP_MASK;
+    if (!data || size < TEX_HEADER_SIZE ||
+        data[0] != 'R' || data[1] != 'T' || data[2] != 'T' || data[3] != 'X' ||
+        data[4] != TEX_VERSION || data[5] > TEX_MAX_BITS ||
+        size != TEX_HEADER_SIZE + ((size_t)sizeof(Color) << (2 * data[5]))) {
+      unload();
+      return false;
     }
 
-    if (normal.y.n) {
-      tex_x = (tile_x >> LERP_BITS);
-      tex_y = (tile_z >> LERP_BITS);
+    bits = data[5];
+    bitmap = (const Color*)(data + TEX_HEADER_SIZE);
+    return true;
+  }
 
-      sub_x = tile_x & LERP_MASK;
-      sub_y = tile_z & LERP_MASK;
-    }
+  /* Closes the AppVar holding the texels, if there is one
+   */
+  void unload() {
+    if (var) close_var(var);
 
-    if (normal.z.n) {
-      tex_x = (tile_x >> LERP_BITS);
-      tex_y = (tile_y >> LERP_BITS);
+    var = 0;
+    bitmap = nullptr;
+  }
 
-      sub_x = tile_x & LERP_MASK;
-      sub_y = tile_y & LERP_MASK;
-    }
+  /* Samples the texture on a plane at texture coordinates (u, v), measured
+   * from the plane origin
+   */
+  Color sample(Fixed24 u, Fixed24 v) {
+    int16_t mask = (1 << bits) - 1;
+
+    // Compute the texture color at this position
+    int24_t tile_x = u.floor(LERP_BITS + bits - 1) - LERP_HALF;
+    int24_t tile_y = v.floor(LERP_BITS + bits - 1) - LERP_HALF;
+
+    int24_t tex_x = (tile_x >> LERP_BITS);
+    int24_t tex_y = (tile_y >> LERP_BITS);
+
+    int8_t sub_x = tile_x & LERP_MASK;
+    int8_t sub_y = tile_y & LERP_MASK;
 
     int16_t tex_x0 = tex_x;
     int16_t tex_x1 = (tex_x + 1);
     int16_t tex_y0 = tex_y;
     int16_t tex_y1 = (tex_y + 1);
 
-    tex_x0 = tex_x0 < 0        ?        0 : tex_x0;
-    tex_x1 = tex_x1 > TEX_MASK ? TEX_MASK : tex_x1;
-    tex_y0 = tex_y0 < 0        ?        0 : tex_y0;
-    tex_y1 = tex_y1 > TEX_MASK ? TEX_MASK : tex_y1;
+    // Clamp both ends, since samples just off the edge would otherwise read
+    // outside of the AppVar
+    tex_x0 = tex_x0 < 0 ? 0 : tex_x0 > mask ? mask : tex_x0;
+    tex_x1 = tex_x1 < 0 ? 0 : tex_x1 > mask ? mask : tex_x1;
+    tex_y0 = tex_y0 < 0 ? 0 : tex_y0 > mask ? mask : tex_y0;
+    tex_y1 = tex_y1 < 0 ? 0 : tex_y1 > mask ? mask : tex_y1;
 
-    Color tex00 = bitmap[tex_y0][tex_x0];
-    Color tex10 = bitmap[tex_y0][tex_x1];
-    Color tex01 = bitmap[tex_y1][tex_x0];
-    Color tex11 = bitmap[tex_y1][tex_x1];
+    Color tex00 = bitmap[(tex_y0 << bits) + tex_x0];
+    Color tex10 = bitmap[(tex_y0 << bits) + tex_x1];
+    Color tex01 = bitmap[(tex_y1 << bits) + tex_x0];
+    Color tex11 = bitmap[(tex_y1 << bits) + tex_x1];
 
     return bilinear(tex00, tex10, tex01, tex11, sub_x, sub_y);
   }
@@ -75,13 +114,15 @@ struct Texture {
   /* Samples the texture on a sphere with origin (0, 0, 0)
    */
   Color sample(Vec3& normal) {
+    int16_t mask = (1 << bits) - 1;
+
     // Compute the spherical coordinates of this normal
     Fixed24 theta = atan2(normal.x, normal.z);
     Fixed24   phi = (Fixed24(1) + asin(normal.y));\
 
     // Compute the texture index of this point
-    int24_t tile_x = theta.floor(LERP_BITS + TEX_BITS - 1) - LERP_HALF;
-    int24_t tile_y =   phi.floor(LERP_BITS + TEX_BITS - 1) - LERP_HALF;
+    int24_t tile_x = theta.floor(LERP_BITS + bits - 1) - LERP_HALF;
+    int24_t tile_y =   phi.floor(LERP_BITS + bits - 1) - LERP_HALF;
 
     // Compute the texel coordinates
     int8_t tex_x = tile_x >> LERP_BITS;
@@ -96,220 +137,18 @@ struct Texture {
     int16_t tex_y0 =  tex_y;
     int16_t tex_y1 = (tex_y + 1);
 
-    tex_x0 = tex_x0 < 0        ?        0 : tex_x0;
-    tex_x1 = tex_x1 > TEX_MASK ? TEX_MASK : tex_x1;
-    tex_y0 = tex_y0 < 0        ?        0 : tex_y0;
-    tex_y1 = tex_y1 > TEX_MASK ? TEX_MASK : tex_y1;
+    // Clamp both ends, since samples just off the edge would otherwise read
+    // outside of the AppVar
+    tex_x0 = tex_x0 < 0 ? 0 : tex_x0 > mask ? mask : tex_x0;
+    tex_x1 = tex_x1 < 0 ? 0 : tex_x1 > mask ? mask : tex_x1;
+    tex_y0 = tex_y0 < 0 ? 0 : tex_y0 > mask ? mask : tex_y0;
+    tex_y1 = tex_y1 < 0 ? 0 : tex_y1 > mask ? mask : tex_y1;
 
-    Color tex00 = bitmap[tex_y0][tex_x0];
-    Color tex10 = bitmap[tex_y0][tex_x1];
-    Color tex01 = bitmap[tex_y1][tex_x0];
-    Color tex11 = bitmap[tex_y1][tex_x1];
+    Color tex00 = bitmap[(tex_y0 << bits) + tex_x0];
+    Color tex10 = bitmap[(tex_y0 << bits) + tex_x1];
+    Color tex01 = bitmap[(tex_y1 << bits) + tex_x0];
+    Color tex11 = bitmap[(tex_y1 << bits) + tex_x1];
 
     return bilinear(tex00, tex10, tex01, tex11, sub_x, sub_y);
   }
-};
-
-
-
-// The wood floor texture
-Texture wood_tex = { {
-  {0xee11, 0xee11, 0xe611, 0xe611, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xe612, 0xe611, 0xe612, 0xe612, 0xe612, 0xe612, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xe612, 0xee12, 0xee53, 0xee12, 0xee52, 0xee52, 0xee12, 0xe5d1, 0xdd4f, 0xdd8f, 0xdd8f, 0xdd90, 0xe5d0, 0xdd90, 0xdd90, 0xdd90, 0xdd8f, 0xdd90, 0xdd90, 0xe590, 0xe5d0, 0xe5d0, 0xe5d0, 0xdd90, 0xdd90, 0xdd90, 0xdd90, 0xdd90, 0xdd90, 0xdd90, 0xdd8f, 0xd50e, 0xdd8f, 0xddd0, 0xe5d0, 0xe5d0, 0xe5d0, 0xddd0, 0xddd0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5cf, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xdd8f, 0xdd4f, 0xdd8f, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xdd8f, 0xdd8f, 0xdd8f, 0xe590, 0xddd1, 0xee52, 0xee12, 0xee12, 0xee12, 0xe612, 0xee12, 0xee12, 0xe612, 0xee12, 0xe612, 0xe612, 0xe612, 0xe611, 0xe611, 0xe612, 0xe612, 0xee12, 0xe612, 0xee52, 0xee12, 0xee12, 0xe612, 0xee12, 0xee52, 0xee53, 0xee53, 0xee52, 0xee52, 0xee52, 0xee52, 0xee12, 0xee12, 0xee11},
-  {0xee11, 0xee11, 0xee11, 0xee11, 0xee11, 0xee12, 0xee12, 0xee11, 0xee12, 0xee52, 0xee12, 0xee12, 0xee12, 0xee12, 0xee11, 0xe611, 0xe5d1, 0xe611, 0xee11, 0xee11, 0xee11, 0xee12, 0xee12, 0xee52, 0xee12, 0xee52, 0xee52, 0xe611, 0xdd8f, 0xdd8f, 0xe58f, 0xe590, 0xe5d0, 0xe5d0, 0xe5d1, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d1, 0xe611, 0xe5d0, 0xdd8f, 0xedd1, 0xe5d0, 0xe5d0, 0xe590, 0xdd8f, 0xe590, 0xdd8f, 0xe590, 0xedd1, 0xe5d1, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe590, 0xe590, 0xdd8f, 0xdd4e, 0xe54e, 0xe5cf, 0xe5cf, 0xe5cf, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe590, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5cf, 0xdd8e, 0xdd8f, 0xdd8f, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe590, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d1, 0xee52, 0xee52, 0xee12, 0xee12, 0xee12, 0xee12, 0xee52, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee11, 0xe611, 0xee11, 0xee52, 0xee52, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee52, 0xee53, 0xee53, 0xee52, 0xee52, 0xee52, 0xee52, 0xee12, 0xee12, 0xee52},
-  {0xee11, 0xe5d0, 0xee11, 0xee12, 0xee11, 0xe5d0, 0xee11, 0xee11, 0xee52, 0xee12, 0xee11, 0xee11, 0xee12, 0xee12, 0xee12, 0xee52, 0xee52, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee52, 0xee52, 0xee12, 0xe611, 0xedd1, 0xee11, 0xee11, 0xe5d1, 0xe5d1, 0xee11, 0xee11, 0xe5d1, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d1, 0xe5d1, 0xe5d0, 0xe590, 0xe590, 0xe590, 0xe5d0, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d0, 0xe5d0, 0xedd1, 0xe5d1, 0xe5d1, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xedd0, 0xe58f, 0xe58f, 0xe54e, 0xdd4d, 0xdd0d, 0xdd8e, 0xedcf, 0xedd0, 0xedd0, 0xee10, 0xedd0, 0xee11, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xedd1, 0xee11, 0xee11, 0xee11, 0xee11, 0xee11, 0xee11, 0xee11, 0xee11, 0xedd1, 0xee11, 0xee11, 0xedd1, 0xedd1, 0xe5d1, 0xee11, 0xee12, 0xee12, 0xee12, 0xee12, 0xee11, 0xee11, 0xee12, 0xe611, 0xe611, 0xee11, 0xee52, 0xee53, 0xee53, 0xe612, 0xe612, 0xee53, 0xee52, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee52, 0xee12, 0xee52, 0xee52, 0xee51, 0xee11, 0xee11, 0xee11},
-  {0xee11, 0xe5d0, 0xee12, 0xee52, 0xee52, 0xee52, 0xee12, 0xee12, 0xee12, 0xee12, 0xee11, 0xee12, 0xee52, 0xee11, 0xee11, 0xee11, 0xee11, 0xee12, 0xe611, 0xee11, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee52, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d1, 0xe5d1, 0xedd1, 0xedd1, 0xee11, 0xee11, 0xedd1, 0xedd1, 0xe5d1, 0xe5d0, 0xe5d0, 0xe5d1, 0xe5d0, 0xe5d0, 0xe590, 0xe590, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xedd0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xedd0, 0xedd0, 0xe5cf, 0xe5cf, 0xe58f, 0xedd0, 0xe5d0, 0xe5d0, 0xe5cf, 0xe5d0, 0xe5d0, 0xe5d1, 0xedd1, 0xedd1, 0xedd1, 0xe5d1, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d1, 0xe5d1, 0xee11, 0xee11, 0xee11, 0xedd1, 0xee11, 0xee11, 0xedd1, 0xedd1, 0xe5d1, 0xe5d1, 0xee12, 0xee12, 0xee11, 0xee11, 0xee11, 0xe611, 0xee11, 0xee11, 0xee12, 0xee12, 0xee52, 0xee53, 0xee53, 0xee53, 0xee12, 0xe5d1, 0xe5d0, 0xee52, 0xee53, 0xee52, 0xee52, 0xee53, 0xee53, 0xee52, 0xee52, 0xee12, 0xee12, 0xee12, 0xee52, 0xe611, 0xee11, 0xee52, 0xee12},
-  {0xee52, 0xee11, 0xee12, 0xee52, 0xee52, 0xee12, 0xee11, 0xee12, 0xee12, 0xee12, 0xee52, 0xee52, 0xee52, 0xee52, 0xee52, 0xee12, 0xee52, 0xee12, 0xee12, 0xee12, 0xee11, 0xee11, 0xee12, 0xee52, 0xee12, 0xee52, 0xee12, 0xe5d1, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe58f, 0xe54f, 0xe5d0, 0xdd90, 0xe590, 0xe590, 0xe5d0, 0xe58f, 0xe58f, 0xe5d0, 0xe5d1, 0xe5d1, 0xee11, 0xe611, 0xee11, 0xe611, 0xee11, 0xedd1, 0xedd1, 0xee11, 0xee11, 0xee11, 0xee11, 0xe5d1, 0xe5d1, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5cf, 0xe5cf, 0xe5d0, 0xe5d1, 0xe5d1, 0xee11, 0xedd1, 0xedd1, 0xedd1, 0xe5d0, 0xe5d0, 0xe5d0, 0xedd1, 0xe5d1, 0xee11, 0xee11, 0xee11, 0xee11, 0xee11, 0xee11, 0xee11, 0xedd1, 0xe5d1, 0xe5d1, 0xe5d0, 0xe5d0, 0xedd1, 0xe5d1, 0xee52, 0xee52, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee52, 0xee12, 0xee53, 0xee53, 0xee53, 0xee54, 0xee53, 0xe5d1, 0xe58f, 0xe5d0, 0xee52, 0xee53, 0xee12, 0xee52, 0xee53, 0xee53, 0xee53, 0xee52, 0xee52, 0xee52, 0xee52, 0xee52, 0xee52, 0xee12, 0xee12, 0xee12},
-  {0xee11, 0xe611, 0xee11, 0xee11, 0xee11, 0xee11, 0xe611, 0xee12, 0xee12, 0xee52, 0xee52, 0xee12, 0xee12, 0xee11, 0xee12, 0xee12, 0xe612, 0xee12, 0xee12, 0xee12, 0xee12, 0xee52, 0xee12, 0xe611, 0xe611, 0xee11, 0xee12, 0xe5d1, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe58f, 0xe590, 0xe5d0, 0xe58f, 0xe58f, 0xe5d0, 0xe5d0, 0xedd0, 0xe5d0, 0xe5d0, 0xe5d1, 0xee11, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe611, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d1, 0xee11, 0xee11, 0xee11, 0xe5d1, 0xe5d0, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xddd1, 0xee52, 0xee52, 0xee12, 0xee12, 0xee52, 0xee52, 0xee52, 0xee52, 0xee52, 0xee52, 0xee52, 0xee53, 0xee53, 0xee52, 0xe5d1, 0xe611, 0xee10, 0xe611, 0xee12, 0xee11, 0xee12, 0xee53, 0xee53, 0xee53, 0xee52, 0xee52, 0xee52, 0xee12, 0xee12, 0xee12, 0xee11, 0xee12, 0xee12},
-  {0xee12, 0xee52, 0xe612, 0xee12, 0xee12, 0xee12, 0xee52, 0xee12, 0xee12, 0xee12, 0xe612, 0xee12, 0xee12, 0xee11, 0xee12, 0xee11, 0xe611, 0xe611, 0xee11, 0xee11, 0xee11, 0xee11, 0xee52, 0xee12, 0xee12, 0xe611, 0xe611, 0xe5d1, 0xe5d0, 0xdd90, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d1, 0xe610, 0xe5d0, 0xe5d0, 0xdd8f, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d1, 0xddd0, 0xdd8f, 0xdd8f, 0xdd8f, 0xe5d0, 0xedd1, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe590, 0xe5d0, 0xe5d0, 0xe58f, 0xe590, 0xe590, 0xe58f, 0xe590, 0xe590, 0xe5d0, 0xe5d0, 0xe5d0, 0xe590, 0xdd90, 0xe5d0, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xdd90, 0xdd8f, 0xe58f, 0xe58f, 0xe590, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe5d0, 0xe5d0, 0xe58f, 0xe58f, 0xe590, 0xe590, 0xe5d0, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d2, 0xee53, 0xee53, 0xee52, 0xee52, 0xe611, 0xee12, 0xee12, 0xee12, 0xee12, 0xe611, 0xee12, 0xee52, 0xee52, 0xee12, 0xee12, 0xe611, 0xe5d0, 0xe5d0, 0xee11, 0xe5d0, 0xe611, 0xe612, 0xee52, 0xee52, 0xee52, 0xee12, 0xee52, 0xee53, 0xee12, 0xe612, 0xe612, 0xee52, 0xee52},
-  {0xdd8f, 0xdd8f, 0xd54e, 0xdd8e, 0xdd4e, 0xd54d, 0xd50f, 0xdd8f, 0xddd1, 0xddd1, 0xe5d2, 0xddd1, 0xddd1, 0xe5d1, 0xe5d1, 0xddd1, 0xddd0, 0xddd0, 0xe5d1, 0xe5d1, 0xe611, 0xe612, 0xe612, 0xe612, 0xe612, 0xddd1, 0xdd90, 0xdd90, 0xd50e, 0xd54e, 0xdd90, 0xdd8f, 0xdd8f, 0xdd4f, 0xdd90, 0xdd90, 0xdd90, 0xdd90, 0xdd90, 0xd590, 0xd54f, 0xdd90, 0xdd90, 0xdd90, 0xd54f, 0xd54f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd90, 0xdd90, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8e, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xd54e, 0xd54e, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd4f, 0xdd8f, 0xdd8f, 0xd54f, 0xd54f, 0xd54f, 0xd54e, 0xdd8f, 0xdd8f, 0xdd4f, 0xdd4e, 0xdd4f, 0xd54e, 0xd58f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xddd1, 0xe611, 0xe5d1, 0xe5d0, 0xddd0, 0xdd90, 0xdd8f, 0xdd8f, 0xdd8f, 0xd54e, 0xdd8f, 0xe590, 0xe5d0, 0xdd90, 0xdd8f, 0xdd8f, 0xd54e, 0xd54d, 0xdd4e, 0xdd8f, 0xdd4e, 0xdd4f, 0xdd8f, 0xdd8f, 0xdd90, 0xdd90, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f},
-  {0xdd4c, 0xdd4c, 0xdd0c, 0xdd4c, 0xdd4c, 0xdd0b, 0xcc8c, 0xdd4e, 0xe5d1, 0xe611, 0xe612, 0xe612, 0xe611, 0xe611, 0xee11, 0xe611, 0xe611, 0xe5d1, 0xe5d1, 0xe611, 0xee12, 0xee52, 0xee52, 0xee12, 0xee12, 0xe611, 0xdd8f, 0xd50d, 0xdd0d, 0xdd4e, 0xe58f, 0xe58f, 0xe5d0, 0xdd4f, 0xdd4f, 0xe5d0, 0xe5d0, 0xdd8f, 0xdd90, 0xddd0, 0xcd4f, 0xdd8f, 0xdd8e, 0xd54e, 0xdd8e, 0xdd8f, 0xe58f, 0xe58f, 0xdd8f, 0xdd8f, 0xe58f, 0xe58e, 0xdd8e, 0xdd4e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58f, 0xe58f, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xdd8e, 0xdd8e, 0xe58e, 0xe58e, 0xe58e, 0xdd8e, 0xe58e, 0xe58e, 0xe58f, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xdd8d, 0xe58e, 0xdd8e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58d, 0xe58d, 0xe58e, 0xdd4d, 0xdd4d, 0xdd4d, 0xd50d, 0xdd4d, 0xdd4d, 0xdd0c, 0xdd0c, 0xdd0c, 0xd50c, 0xdd4d, 0xdd4d, 0xdd4c, 0xdd4c, 0xdd0c, 0xd50c, 0xd50c, 0xdd4c, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4c, 0xdd4c, 0xdd4c, 0xdd4c, 0xdd4c, 0xdd4c, 0xdd4c, 0xdd4c},
-  {0xdd4d, 0xdd4d, 0xdd4d, 0xdd4c, 0xdd0b, 0xd50b, 0xd4cc, 0xd54d, 0xdd8f, 0xe5d0, 0xe5d1, 0xe612, 0xe611, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe611, 0xe611, 0xee11, 0xe611, 0xe611, 0xe5d1, 0xe5d0, 0xdd8f, 0xdd8e, 0xe58e, 0xe5cf, 0xe5d0, 0xee10, 0xe58f, 0xe58e, 0xe5d0, 0xee11, 0xee11, 0xe5d0, 0xe5d1, 0xe611, 0xd54f, 0xdd8f, 0xdd8f, 0xdd4e, 0xdd4e, 0xe58f, 0xe58f, 0xdd8e, 0xe58e, 0xdd8e, 0xe58f, 0xe58f, 0xdd8e, 0xdd4e, 0xdd4e, 0xe58e, 0xdd8e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xdd8d, 0xdd8d, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xdd8e, 0xdd8e, 0xe58e, 0xe58d, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xdd8e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xdd4d, 0xdd4d, 0xdd4e, 0xdd4d, 0xd50d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xe58e, 0xe58e, 0xe58e, 0xdd8e, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4c, 0xdd4c, 0xdd4d},
-  {0xdd4d, 0xdd4d, 0xdd4d, 0xdd0c, 0xdd4c, 0xdd4c, 0xd50d, 0xdd4e, 0xdd8f, 0xddd0, 0xe5d1, 0xddd0, 0xddd0, 0xddd0, 0xddd0, 0xdd8f, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe611, 0xe611, 0xe5d1, 0xdd8f, 0xdd90, 0xe5d0, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xe5cf, 0xe5d0, 0xe58f, 0xe58e, 0xe5cf, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d1, 0xdd90, 0xdd8f, 0xdd8f, 0xdd8e, 0xdd8e, 0xe58f, 0xe58f, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8f, 0xdd8e, 0xdd8e, 0xdd4d, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xdd8e, 0xe58e, 0xe58e, 0xe58e, 0xdd8e, 0xdd8e, 0xdd8e, 0xe58e, 0xe58e, 0xe58e, 0xdd8e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xdd8e, 0xe58e, 0xe58e, 0xdd8e, 0xdd4e, 0xdd8e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58d, 0xdd8d, 0xe58e, 0xe58e, 0xe58e, 0xdd8d, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xdd8d, 0xe58e, 0xe58e, 0xe58e, 0xdd8e, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd8d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4e, 0xdd8e, 0xe58e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xd50c, 0xd50c, 0xdd4d},
-  {0xe58e, 0xe58e, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xd50d, 0xdd8f, 0xdd8f, 0xdd90, 0xdd90, 0xddd0, 0xddd0, 0xddd0, 0xddd0, 0xddd0, 0xddd1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe611, 0xe5d0, 0xe5d0, 0xdd90, 0xe590, 0xe5d0, 0xe5d0, 0xe5d0, 0xdd4e, 0xe5cf, 0xe5d0, 0xe5cf, 0xe58f, 0xe5cf, 0xe5cf, 0xedd0, 0xe5d0, 0xe5d0, 0xe5d0, 0xee11, 0xdd8f, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe5cf, 0xe58e, 0xe58e, 0xe58e, 0xe58f, 0xe58f, 0xe58f, 0xe58e, 0xe58f, 0xe58e, 0xe58e, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xdd8e, 0xdd8e, 0xe58f, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xdd8e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xdd8e, 0xe58e, 0xdd8e, 0xdd8e, 0xdd8d, 0xdd8e, 0xdd8d, 0xdd8d, 0xdd8d, 0xdd8d, 0xdd4d, 0xd54d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd0c, 0xd50c, 0xdd4c, 0xdd4d, 0xdd4d, 0xe58d, 0xe54d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xe54d, 0xdd4d, 0xdd4c, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xe58e},
-  {0xe58e, 0xe58e, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4c, 0xd50d, 0xdd4f, 0xdd90, 0xdd90, 0xdd90, 0xddd0, 0xe5d0, 0xddd0, 0xddd0, 0xddd0, 0xddd1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe611, 0xe610, 0xe5d0, 0xe611, 0xe5d1, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xdd8e, 0xe58f, 0xdd8e, 0xe58f, 0xe5cf, 0xe58f, 0xe5cf, 0xe58e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xe58f, 0xe58f, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe5cf, 0xe58f, 0xe58e, 0xe5cf, 0xe58f, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xdd4d, 0xd50d, 0xdd4d, 0xd50c, 0xd50c, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4e, 0xdd4e, 0xdd4e, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xe58e},
-  {0xdd4d, 0xdd8d, 0xdd4d, 0xd50b, 0xdd0b, 0xdd0c, 0xd50d, 0xdd8f, 0xdd90, 0xdd90, 0xddd0, 0xe5d0, 0xe5d0, 0xe5d0, 0xddd0, 0xdd90, 0xdd90, 0xddd0, 0xddd0, 0xe5d1, 0xe5d1, 0xe611, 0xe5d1, 0xe5d0, 0xe5d0, 0xe611, 0xee11, 0xe611, 0xe611, 0xe5d1, 0xe5d0, 0xe5d0, 0xe5d0, 0xddd0, 0xe5d0, 0xe5d0, 0xe5d1, 0xe5d1, 0xe5d0, 0xe5d0, 0xdd8e, 0xe58e, 0xdd8e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe5cf, 0xe5cf, 0xe58f, 0xe5cf, 0xe5cf, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58f, 0xe58f, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe58e, 0xe5cf, 0xe58e, 0xe5cf, 0xe58f, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe5cf, 0xe58e, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe58f, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xdd8e, 0xdd4e, 0xdd4e, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xe58e, 0xe58e, 0xe58e, 0xdd8e, 0xe58e, 0xe58f, 0xe58f, 0xe58f, 0xdd8e, 0xdd8e, 0xdd4e, 0xdd4e, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d},
-  {0xdd8e, 0xdd8e, 0xe58e, 0xe58e, 0xdd4d, 0xdd4d, 0xd54e, 0xdd90, 0xe5d0, 0xe5d0, 0xddd0, 0xddd0, 0xe5d1, 0xe5d0, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe611, 0xe611, 0xe611, 0xe611, 0xe611, 0xe611, 0xe611, 0xee12, 0xe612, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d0, 0xe5d0, 0xe5d0, 0xdd4e, 0xe58d, 0xdd4d, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xdd8e, 0xe58e, 0xe58e, 0xe5ce, 0xe58e, 0xe5ce, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe58e, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xdd8e, 0xd54e, 0xdd4e, 0xd54d, 0xdd4e, 0xdd4e, 0xdd8e, 0xe58f, 0xe58f, 0xe58f, 0xdd8f, 0xdd8e, 0xdd4e, 0xdd4e, 0xdd8e, 0xdd8e, 0xdd4e, 0xdd4e, 0xdd4d, 0xd54d, 0xd54d, 0xd50d, 0xdd4d, 0xdd4d, 0xdd4e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xe58e},
-  {0xdd90, 0xdd8f, 0xdd8f, 0xdd8f, 0xe590, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd4f, 0xdd4e, 0xdd8f, 0xdd4f, 0xdd4f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xe58f, 0xdd8f, 0xdd90, 0xdd8f, 0xdd90, 0xdd90, 0xe590, 0xe5d0, 0xddd0, 0xe5d0, 0xddd0, 0xd54e, 0xd50d, 0xdd0d, 0xdd0d, 0xd50c, 0xdd0c, 0xd50c, 0xd50c, 0xd50c, 0xd4cc, 0xd4cb, 0xd4cc, 0xd50c, 0xd50c, 0xd50c, 0xd50c, 0xd50c, 0xd50c, 0xd50c, 0xd54d, 0xd50d, 0xd54d, 0xd54d, 0xd54d, 0xd50d, 0xd50d, 0xd50d, 0xd50c, 0xd50c, 0xd50d, 0xd54d, 0xd50d, 0xd50c, 0xd50c, 0xcccc, 0xcccc, 0xcccc, 0xd50d, 0xd50d, 0xdd4f, 0xd54f, 0xdd4f, 0xdd8f, 0xdd90, 0xdd90, 0xdd8f, 0xd54f, 0xd54f, 0xdd4f, 0xdd8f, 0xdd90, 0xddd0, 0xdd90, 0xdd90, 0xdd90, 0xdd8f, 0xdd8f, 0xd54f, 0xdd8f, 0xdd8f, 0xdd4f, 0xd54f, 0xd50e, 0xdd8f, 0xdd90, 0xddd0, 0xdd90, 0xdd90, 0xdd90, 0xdd90, 0xdd90, 0xdd90, 0xdd90, 0xdd90, 0xdd8f, 0xdd90, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd90, 0xddd0, 0xddd0, 0xdd90, 0xdd90, 0xdd4f, 0xd54e, 0xdd8f, 0xdd8f, 0xd54e, 0xe5d0, 0xdd90, 0xdd90, 0xdd90, 0xddd0, 0xdd90, 0xdd90, 0xdd90},
-  {0xe5d1, 0xe5d1, 0xee11, 0xe611, 0xe611, 0xee11, 0xe5d1, 0xe611, 0xee11, 0xee11, 0xedd1, 0xee12, 0xee12, 0xee12, 0xee11, 0xe5d1, 0xee11, 0xee11, 0xee11, 0xee11, 0xe611, 0xee11, 0xee11, 0xee11, 0xee11, 0xee11, 0xe5d0, 0xe5d1, 0xe5d1, 0xdd8f, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe54d, 0xe54d, 0xe54d, 0xdd4d, 0xdd4d, 0xdd4d, 0xe58d, 0xe54d, 0xe54d, 0xe54d, 0xdd4d, 0xdd4d, 0xe54d, 0xe58e, 0xe58e, 0xdd8e, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4e, 0xdd4d, 0xe54e, 0xdd4d, 0xe58e, 0xe58e, 0xe58e, 0xdd0d, 0xdd0c, 0xd50c, 0xd50c, 0xdd0c, 0xdd4d, 0xdd4e, 0xdd8f, 0xdd8f, 0xe590, 0xe590, 0xe5d0, 0xe590, 0xe5d0, 0xe5d0, 0xe5d1, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d1, 0xe5d1, 0xe5d1, 0xdd8f, 0xe611, 0xe5d1, 0xe5d0, 0xe5d0, 0xe590, 0xe590, 0xdd8f, 0xdd8f, 0xe5d1, 0xe5d1, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe58f, 0xe5d0, 0xe5cf, 0xe58f, 0xe58f, 0xe58f, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe590, 0xe58f, 0xe5d0, 0xe5d0, 0xedd0, 0xe5d0, 0xdd8f, 0xee11, 0xee11, 0xe611, 0xe611, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d0},
-  {0xe611, 0xee12, 0xee52, 0xe612, 0xee12, 0xe612, 0xee12, 0xe611, 0xee11, 0xe611, 0xe612, 0xe612, 0xe612, 0xe612, 0xee12, 0xe611, 0xe611, 0xe611, 0xe611, 0xe5d0, 0xe5cf, 0xddd0, 0xdd8f, 0xdd90, 0xddd0, 0xe611, 0xe611, 0xee12, 0xe611, 0xddd0, 0xdd8e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xdd8e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58f, 0xe58e, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58e, 0xe58e, 0xe58f, 0xdd8f, 0xe58f, 0xe58f, 0xe5cf, 0xe58f, 0xe5cf, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe5cf, 0xe58e, 0xe58e, 0xdd8d, 0xdd8d, 0xe58e, 0xe5ce, 0xdd8f, 0xe5d1, 0xee11, 0xee11, 0xe5d1, 0xe5d1, 0xe5d1, 0xe611, 0xe5d1, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d1, 0xe5d1, 0xe5d0, 0xdd8f, 0xe590, 0xe590, 0xe590, 0xe5d1, 0xe5d0, 0xe5d1, 0xe5d1, 0xedd1, 0xe5d1, 0xe5d1, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d1, 0xe5d1, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xdd4e, 0xdd4e, 0xdd4e, 0xdd0d, 0xdd0c, 0xdd4e, 0xe5cf, 0xe5d0, 0xe5d0, 0xee11, 0xee11, 0xee11, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xdd90, 0xee11, 0xe5d1, 0xe5d1, 0xe611, 0xee12, 0xee52, 0xee12, 0xee52},
-  {0xe612, 0xee12, 0xee12, 0xe612, 0xe611, 0xe611, 0xe611, 0xe5d1, 0xe611, 0xe612, 0xe612, 0xe611, 0xe612, 0xe611, 0xe611, 0xe611, 0xee12, 0xee12, 0xee12, 0xe611, 0xe5d0, 0xee12, 0xee52, 0xee12, 0xee12, 0xee12, 0xee12, 0xe611, 0xe612, 0xddd0, 0xe5cf, 0xe5cf, 0xe5d0, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5d0, 0xe5d0, 0xe5cf, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xdd8f, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5cf, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5cf, 0xe5cf, 0xdd8f, 0xe5cf, 0xe5cf, 0xe5d0, 0xe5d0, 0xe5cf, 0xe58e, 0xe58d, 0xe58d, 0xe5ce, 0xe5cf, 0xdd8f, 0xedd1, 0xe5d1, 0xe5d1, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d1, 0xe5d1, 0xe5d0, 0xe5d1, 0xedd1, 0xedd1, 0xe5d1, 0xedd1, 0xedd1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d0, 0xe5d0, 0xe590, 0xe590, 0xe5d0, 0xe5d0, 0xe590, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xedd0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xedd0, 0xedd0, 0xe5cf, 0xe5cf, 0xe58f, 0xe5d0, 0xe5d0, 0xe5cf, 0xe5cf, 0xe5d0, 0xe5d0, 0xe5d0, 0xedd1, 0xedd1, 0xe5d1, 0xdd90, 0xddd0, 0xe611, 0xe611, 0xe611, 0xee12, 0xee53, 0xee12, 0xee12},
-  {0xee12, 0xe612, 0xe612, 0xee12, 0xe612, 0xe612, 0xe612, 0xe612, 0xee12, 0xee12, 0xee52, 0xee12, 0xee52, 0xee12, 0xee12, 0xee12, 0xee11, 0xee11, 0xee52, 0xe611, 0xe5d0, 0xee52, 0xee52, 0xee52, 0xe611, 0xe611, 0xe612, 0xe612, 0xe612, 0xe5d1, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5cf, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5cf, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5cf, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5cf, 0xe58e, 0xe58e, 0xe58e, 0xe5cf, 0xe5cf, 0xdd8f, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xedd1, 0xedd0, 0xe5d0, 0xe590, 0xe590, 0xe590, 0xe590, 0xe590, 0xe590, 0xe590, 0xdd4f, 0xdd4f, 0xe590, 0xe5d1, 0xe5d1, 0xee11, 0xee11, 0xee11, 0xee11, 0xee11, 0xee11, 0xedd1, 0xee11, 0xee11, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5d0, 0xe5d0, 0xedd1, 0xee11, 0xedd1, 0xedd1, 0xe5d1, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe611, 0xe612, 0xe612, 0xee52, 0xee53, 0xee53, 0xee13, 0xee13},
-  {0xee12, 0xee12, 0xee12, 0xee52, 0xee12, 0xee12, 0xee52, 0xee52, 0xee52, 0xee52, 0xee52, 0xee52, 0xee52, 0xee12, 0xe612, 0xe612, 0xee12, 0xee12, 0xee11, 0xe611, 0xe611, 0xe611, 0xe611, 0xee12, 0xe611, 0xe612, 0xe612, 0xee52, 0xee12, 0xe5d1, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xdd8f, 0xe5cf, 0xe5cf, 0xe5d0, 0xe5d0, 0xe5cf, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe611, 0xe611, 0xe611, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe610, 0xddd0, 0xe5d0, 0xe590, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe58f, 0xe58f, 0xe590, 0xe5d0, 0xe5d1, 0xe611, 0xe611, 0xee11, 0xe611, 0xee11, 0xee11, 0xee11, 0xe5d1, 0xe5d1, 0xe5d0, 0xe5d0, 0xe5d1, 0xe5d1, 0xe611, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xedd1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xdd90, 0xee12, 0xee12, 0xee12, 0xee12, 0xe611, 0xee12, 0xee53, 0xee53},
-  {0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee11, 0xee11, 0xee12, 0xee12, 0xee52, 0xee12, 0xe612, 0xee12, 0xee52, 0xe612, 0xe612, 0xee52, 0xee12, 0xee52, 0xe612, 0xee52, 0xe612, 0xe612, 0xe611, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xe5d1, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5cf, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d1, 0xe5d1, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d1, 0xe5d1, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xddcf, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xddd0, 0xe5d0, 0xe5d0, 0xe5d1, 0xe5d1, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xddd0, 0xe5d0, 0xe58f, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe590, 0xdd90, 0xe5d0, 0xedd1, 0xe5d1, 0xedd1, 0xee11, 0xe5d1, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xedd1, 0xe5d1, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe590, 0xe5d0, 0xe5d0, 0xe590, 0xe5d0, 0xe590, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xdd90, 0xe5d0, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xdd90, 0xe58f, 0xe58f, 0xe58f, 0xe590, 0xe5d0, 0xdd8f, 0xee12, 0xee12, 0xe611, 0xe611, 0xee12, 0xee12, 0xe612, 0xe612},
-  {0xddd1, 0xddd0, 0xddd0, 0xddd0, 0xddd0, 0xddd0, 0xddd0, 0xddd0, 0xddd0, 0xddd0, 0xddd0, 0xddd0, 0xddd0, 0xddd0, 0xdd90, 0xdd90, 0xdd90, 0xe5d1, 0xddd0, 0xddd0, 0xdd90, 0xdd90, 0xdd90, 0xdd90, 0xdd90, 0xe5d1, 0xe5d1, 0xe612, 0xe5d1, 0xdd91, 0xdd90, 0xdd90, 0xdd90, 0xdd90, 0xdd90, 0xdd90, 0xdd90, 0xddd1, 0xddd1, 0xdd90, 0xdd90, 0xddd0, 0xddd0, 0xdd90, 0xdd90, 0xdd90, 0xdd90, 0xdd90, 0xdd90, 0xdd90, 0xddd1, 0xddd1, 0xdd91, 0xddd1, 0xddd1, 0xddd1, 0xddd1, 0xddd1, 0xddd1, 0xddd1, 0xddd1, 0xddd1, 0xddd1, 0xddd0, 0xddd0, 0xddd1, 0xddd1, 0xdd90, 0xdd90, 0xdd90, 0xdd8f, 0xdd90, 0xdd90, 0xdd90, 0xddd1, 0xe5d1, 0xe5d1, 0xddd1, 0xddd1, 0xddd1, 0xdd91, 0xddd1, 0xddd1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xddd0, 0xddd0, 0xe5d1, 0xddd1, 0xddd1, 0xddd1, 0xddd0, 0xddd0, 0xddd0, 0xddd0, 0xdd90, 0xdd90, 0xdd90, 0xdd90, 0xdd90, 0xdd8f, 0xdd8f, 0xdd90, 0xdd8f, 0xd54f, 0xd54e, 0xd54f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd4f, 0xdd8f, 0xdd4f, 0xdd8f, 0xd54f, 0xd54e, 0xddd0, 0xddd1, 0xddd0, 0xe5d1, 0xe5d1, 0xddd1, 0xddd1, 0xddd1},
-  {0xdd8f, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xdd8e, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xdd8f, 0xedd0, 0xedd0, 0xedd0, 0xe5d0, 0xedd0, 0xedd0, 0xedd0, 0xedd0, 0xedd0, 0xedd0, 0xedd0, 0xedd1, 0xedd0, 0xedd0, 0xedd0, 0xedd0, 0xedd0, 0xedd0, 0xedd0, 0xee11, 0xee11, 0xedd1, 0xee11, 0xee11, 0xee11, 0xee11, 0xee11, 0xee11, 0xee11, 0xee11, 0xee11, 0xee12, 0xe612, 0xee53, 0xee12, 0xee13, 0xee54, 0xee54, 0xee54, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee54, 0xee53, 0xe612, 0xee13, 0xee53, 0xee54, 0xee13, 0xe612, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee12, 0xee12, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee52, 0xee52, 0xee52, 0xe611, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee52, 0xee53, 0xee53, 0xee12, 0xe5d1, 0xe611, 0xe611, 0xee12, 0xee11, 0xee12, 0xee11, 0xddd0, 0xdd8e, 0xdd4e, 0xdd4e, 0xdd4e, 0xdd8e, 0xdd4e, 0xdd8e, 0xdd8e, 0xe58f, 0xdd8e, 0xdd8e, 0xdd4e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xe58f, 0xe58f, 0xdd8f, 0xdd8e, 0xe58f, 0xdd8e, 0xdd8e, 0xe58e, 0xe58e},
-  {0xdd4e, 0xdd8e, 0xdd8e, 0xdd4e, 0xdd4e, 0xdd4e, 0xdd4e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xdd8e, 0xdd8e, 0xe58e, 0xe58e, 0xe58e, 0xd54e, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee52, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee52, 0xee52, 0xee12, 0xee52, 0xee52, 0xee52, 0xee12, 0xf653, 0xe612, 0xee54, 0xee54, 0xee54, 0xee54, 0xee54, 0xee54, 0xee53, 0xee53, 0xee53, 0xee54, 0xee54, 0xee53, 0xee12, 0xee12, 0xee53, 0xee54, 0xee13, 0xe612, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xe5d1, 0xee12, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee52, 0xee52, 0xee52, 0xee52, 0xee52, 0xee52, 0xee52, 0xee52, 0xee52, 0xee52, 0xee52, 0xee52, 0xee52, 0xee12, 0xee11, 0xee11, 0xee12, 0xee12, 0xee12, 0xee11, 0xee11, 0xe5d0, 0xe58e, 0xe58e, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58e, 0xe58e, 0xdd8f, 0xdd8e, 0xdd8e, 0xdd8e, 0xe58e, 0xe58e, 0xe58f, 0xdd8e, 0xdd8e, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xdd8e, 0xdd4e, 0xdd4e},
-  {0xe58f, 0xe58f, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd4e, 0xdd8e, 0xdd4e, 0xdd4e, 0xdd4e, 0xee53, 0xee53, 0xf653, 0xf653, 0xf653, 0xf653, 0xee53, 0xf653, 0xf653, 0xf653, 0xf654, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xf654, 0xf654, 0xee54, 0xee54, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee54, 0xf654, 0xe613, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee53, 0xee53, 0xee53, 0xee54, 0xee53, 0xe5d1, 0xee12, 0xee53, 0xee53, 0xee53, 0xee53, 0xe611, 0xee53, 0xee53, 0xee53, 0xee53, 0xee12, 0xee12, 0xee52, 0xee53, 0xee53, 0xee53, 0xee53, 0xee52, 0xee52, 0xee12, 0xee12, 0xee12, 0xee52, 0xee52, 0xee12, 0xee12, 0xee11, 0xee11, 0xee11, 0xee52, 0xee52, 0xee12, 0xee52, 0xee52, 0xee12, 0xee12, 0xee52, 0xee12, 0xee52, 0xee12, 0xe5d1, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xdd8e, 0xe58f, 0xe58f, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd4e, 0xdd4e, 0xdd4e, 0xdd4e, 0xe58e, 0xdd8e, 0xe58e, 0xdd4e, 0xdd8e, 0xdd8e, 0xe58f},
-  {0xdd4e, 0xdd8e, 0xdd4e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd4e, 0xe58e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd4e, 0xdd4e, 0xd54e, 0xee12, 0xee12, 0xe5d0, 0xee11, 0xee12, 0xee52, 0xee52, 0xee52, 0xee52, 0xee52, 0xee53, 0xee53, 0xee53, 0xee53, 0xf694, 0xf694, 0xf654, 0xf653, 0xf653, 0xee53, 0xee53, 0xee53, 0xee53, 0xee13, 0xee53, 0xee53, 0xee53, 0xf653, 0xf653, 0xf653, 0xee53, 0xee53, 0xe613, 0xedd1, 0xee53, 0xee53, 0xee12, 0xee12, 0xee53, 0xee53, 0xee53, 0xee54, 0xee54, 0xee53, 0xe5d1, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee12, 0xee12, 0xee53, 0xee53, 0xee53, 0xee53, 0xee12, 0xee12, 0xee12, 0xee52, 0xee52, 0xee52, 0xee53, 0xee52, 0xe611, 0xee11, 0xe5d1, 0xe5d0, 0xdd8f, 0xe58f, 0xe58f, 0xe5d0, 0xe5d0, 0xee11, 0xe611, 0xee12, 0xee12, 0xee12, 0xee52, 0xee52, 0xee52, 0xe612, 0xee52, 0xee52, 0xee52, 0xe5d1, 0xe58f, 0xdd8e, 0xdd4e, 0xdd4d, 0xdd4e, 0xe58e, 0xe58e, 0xe58e, 0xdd8e, 0xdd8e, 0xe58e, 0xdd4e, 0xdd4e, 0xdd4e, 0xdd4e, 0xdd4e, 0xdd4e, 0xdd4e, 0xe54e, 0xdd4e, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4e, 0xdd8e},
-  {0xe58f, 0xe58f, 0xe58f, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xe58e, 0xe58f, 0xe58e, 0xe58e, 0xdd4e, 0xee12, 0xee52, 0xf653, 0xee12, 0xee52, 0xee52, 0xee12, 0xee12, 0xee52, 0xee52, 0xee53, 0xee53, 0xee53, 0xf653, 0xf694, 0xf694, 0xf694, 0xee52, 0xee12, 0xee52, 0xf653, 0xf653, 0xee53, 0xee12, 0xee53, 0xf654, 0xf694, 0xf654, 0xf653, 0xee53, 0xee12, 0xee53, 0xe613, 0xee12, 0xee13, 0xee13, 0xee54, 0xee54, 0xee53, 0xee53, 0xee13, 0xee53, 0xee53, 0xe612, 0xee13, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee12, 0xee12, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee12, 0xe611, 0xee52, 0xee52, 0xee53, 0xee52, 0xee52, 0xee52, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee52, 0xee52, 0xee52, 0xee53, 0xee53, 0xee12, 0xee12, 0xee11, 0xee12, 0xee52, 0xee52, 0xee53, 0xee52, 0xe5d1, 0xe58e, 0xe58f, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe5cf, 0xe5cf, 0xe58e, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe5cf, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xdd8e, 0xdd8e, 0xdd4e, 0xdd8e, 0xe58f},
-  {0xe58f, 0xe58f, 0xe58e, 0xe54e, 0xdd4e, 0xdd4e, 0xdd4e, 0xdd4e, 0xdd4e, 0xdd4e, 0xdd4e, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd0d, 0xd50d, 0xee12, 0xee52, 0xee52, 0xf653, 0xf653, 0xf653, 0xf653, 0xf653, 0xf653, 0xf653, 0xf653, 0xf653, 0xf653, 0xee53, 0xf653, 0xf653, 0xf653, 0xf653, 0xee53, 0xf653, 0xf653, 0xf654, 0xee53, 0xf653, 0xee53, 0xee53, 0xee53, 0xee53, 0xee12, 0xe612, 0xdd90, 0xee12, 0xe613, 0xee12, 0xee53, 0xee53, 0xee13, 0xee12, 0xe612, 0xe5d1, 0xe5d0, 0xe5d1, 0xee12, 0xee13, 0xee13, 0xee13, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee12, 0xee52, 0xee52, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee52, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee12, 0xe611, 0xee52, 0xee53, 0xee53, 0xee52, 0xee52, 0xe5d1, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe58f, 0xe58f, 0xe5d0, 0xe5d0, 0xe58f, 0xe5cf, 0xe58f, 0xe58f, 0xe58f, 0xe58f},
-  {0xe5d0, 0xe5d0, 0xe5cf, 0xe58f, 0xe58f, 0xdd8e, 0xdd8f, 0xdd8f, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd4e, 0xdd4e, 0xdd4e, 0xdd4e, 0xd54e, 0xee12, 0xee52, 0xee53, 0xee53, 0xee53, 0xf653, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xf693, 0xf694, 0xee54, 0xee54, 0xf654, 0xf654, 0xf694, 0xf694, 0xee53, 0xf654, 0xee53, 0xee53, 0xee53, 0xf654, 0xee53, 0xf654, 0xf654, 0xee53, 0xee53, 0xe613, 0xee53, 0xedd1, 0xe5d1, 0xee53, 0xee54, 0xee54, 0xee54, 0xee53, 0xee53, 0xee54, 0xee54, 0xee54, 0xee53, 0xee53, 0xee54, 0xee53, 0xee53, 0xee53, 0xee53, 0xee54, 0xee54, 0xee54, 0xee53, 0xee53, 0xee53, 0xee54, 0xee53, 0xee53, 0xee53, 0xee53, 0xee52, 0xee53, 0xee53, 0xee53, 0xee52, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee52, 0xee52, 0xee12, 0xee12, 0xee12, 0xee13, 0xee12, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xe5d2, 0xee13, 0xee12, 0xee12, 0xee13, 0xee13, 0xee13, 0xee12, 0xee13, 0xee13, 0xee13, 0xee13, 0xee13, 0xee13, 0xee13, 0xee13, 0xee12, 0xe611, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0},
-  {0xddd1, 0xdd90, 0xdd90, 0xdd90, 0xdd90, 0xdd90, 0xdd90, 0xdd90, 0xdd90, 0xcd0d, 0xd50d, 0xd50d, 0xd50d, 0xcccc, 0xc4cb, 0xd50c, 0xd50d, 0xd54e, 0xd54e, 0xd54d, 0xd50d, 0xd50d, 0xd54e, 0xd54d, 0xd50d, 0xd54d, 0xd54e, 0xd54e, 0xd54e, 0xdd4e, 0xd54e, 0xd54d, 0xd54d, 0xd54e, 0xd54e, 0xd54e, 0xdd4e, 0xd54e, 0xdd4e, 0xdd4e, 0xd54d, 0xd54d, 0xd54d, 0xd54d, 0xd54d, 0xd50d, 0xd54d, 0xdd4e, 0xd54e, 0xd54e, 0xdd8e, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xd54e, 0xdd8f, 0xdd8f, 0xdd8e, 0xdd8e, 0xdd4e, 0xdd8e, 0xdd4e, 0xdd8e, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8e, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd4f, 0xdd8f, 0xdd4f, 0xdd4f, 0xdd90, 0xddd0, 0xddd0, 0xdd90, 0xdd90, 0xdd90, 0xdd90, 0xdd90, 0xdd90, 0xdd90, 0xdd90, 0xdd90, 0xdd90, 0xdd90, 0xdd90, 0xdd90, 0xdd90, 0xd590, 0xdd90, 0xddd0, 0xdd90, 0xdd90, 0xddd1, 0xddd1, 0xddd1, 0xddd1, 0xddd1, 0xddd1, 0xddd1, 0xddd1, 0xddd1, 0xddd1, 0xddd1, 0xddd0, 0xddd0, 0xddd1, 0xdd91, 0xdd90, 0xdd90, 0xdd90, 0xddd0, 0xddd0, 0xddd0},
-  {0xe5d1, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe611, 0xe5d1, 0xe5d0, 0xe5d0, 0xd50d, 0xdd4d, 0xdd4d, 0xcccb, 0xd50c, 0xdd4d, 0xdd4d, 0xdd0c, 0xd50c, 0xdd0c, 0xdd4d, 0xdd0c, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4c, 0xdd4c, 0xdd0c, 0xdd0c, 0xdd0c, 0xdd4c, 0xdd4c, 0xdd0c, 0xdd0c, 0xdd0c, 0xdd0c, 0xdd0c, 0xdd0c, 0xdd0c, 0xdd4c, 0xdd4c, 0xdd4d, 0xdd4c, 0xdd4c, 0xdd0b, 0xdd0b, 0xdd4c, 0xdd0c, 0xdd0c, 0xdd4c, 0xdd4c, 0xdd4d, 0xe58d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4c, 0xdd4c, 0xdd4c, 0xdd4c, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xe58d, 0xdd4d, 0xdd4c, 0xdd4d, 0xdd4d, 0xdd4d, 0xe54d, 0xdd4d, 0xdd4d, 0xdd4e, 0xdd4e, 0xdd4e, 0xe58e, 0xdd4e, 0xdd8e, 0xe5d0, 0xddcf, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d1, 0xe5d1, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d1, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xddd0, 0xddd0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xddd0, 0xe5d0, 0xe5d0, 0xe5d1, 0xe611, 0xe5d1, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d1, 0xe5d1, 0xe5d0, 0xe5d0, 0xe5d1, 0xe5d1, 0xe5d0},
-  {0xe5d0, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xd54d, 0xdd4e, 0xdd8e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xdd8d, 0xdd4d, 0xdd8d, 0xdd4d, 0xdd4d, 0xe58e, 0xdd8e, 0xdd8e, 0xe58e, 0xdd8e, 0xdd8e, 0xdd8d, 0xdd8d, 0xe58d, 0xdd8d, 0xe58d, 0xe54d, 0xdd4d, 0xdd8d, 0xdd8e, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xd50c, 0xdd0c, 0xdd0b, 0xd50b, 0xdd0c, 0xdd4c, 0xdd4c, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xe58d, 0xdd8d, 0xdd8d, 0xdd4d, 0xdd4c, 0xdd4c, 0xdd4c, 0xdd4c, 0xdd4c, 0xdd4c, 0xd50c, 0xdd4c, 0xdd4d, 0xdd4d, 0xe58d, 0xe58e, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd8d, 0xdd4e, 0xdd8e, 0xdd8e, 0xdd4e, 0xdd4e, 0xdd4d, 0xdd4d, 0xdd4e, 0xdd8f, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d0, 0xe5d1, 0xe5d1, 0xe611, 0xe5d1, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d1, 0xe611, 0xe611, 0xe610, 0xe5d0},
-  {0xe5ce, 0xdd8e, 0xdd8e, 0xe58e, 0xe5ce, 0xe5ce, 0xe5ce, 0xe5ce, 0xe5cf, 0xd54d, 0xdd4d, 0xdd4d, 0xdd8e, 0xdd4d, 0xdd4e, 0xdd4d, 0xdd4c, 0xdd4c, 0xdd4c, 0xdd4d, 0xdd4d, 0xdd4d, 0xe58e, 0xe58e, 0xdd8e, 0xe58e, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xd54c, 0xd50c, 0xcccc, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xd50c, 0xdd4d, 0xdd4c, 0xdd4c, 0xdd4c, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xd54c, 0xd54d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xe54d, 0xdd4c, 0xdd0b, 0xdd4c, 0xdd4c, 0xdd4d, 0xdd4c, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd8d, 0xdd8d, 0xdd8d, 0xdd8d, 0xe58d, 0xe58d, 0xdd8d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd8d, 0xdd4d, 0xdd8e, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5cf, 0xe5cf, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xddcf, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5cf, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5cf, 0xe5cf, 0xe5cf},
-  {0xe5ce, 0xe58d, 0xe58d, 0xe58d, 0xe58d, 0xe58d, 0xe58d, 0xe58d, 0xdd8d, 0xd50d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4c, 0xdd4c, 0xdd0c, 0xdd4c, 0xdd4c, 0xdd4c, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4c, 0xdd4d, 0xdd4d, 0xdd4d, 0xe58d, 0xdd4d, 0xdd4d, 0xdd8e, 0xe58e, 0xdd8e, 0xdd8e, 0xdd8d, 0xdd8d, 0xdd8d, 0xdd4d, 0xdd4d, 0xe58d, 0xdd8d, 0xe58d, 0xe58d, 0xdd8d, 0xdd8d, 0xdd8d, 0xdd4d, 0xdd4d, 0xdd8d, 0xdd4d, 0xdd8d, 0xdd8d, 0xdd4d, 0xdd4c, 0xdd4c, 0xd50b, 0xd50c, 0xdd4c, 0xdd4d, 0xdd4d, 0xe58d, 0xdd4d, 0xdd4d, 0xdd8d, 0xdd8d, 0xdd4d, 0xdd4c, 0xdd4c, 0xd50c, 0xdd4c, 0xdd8d, 0xdd4d, 0xdd4d, 0xdd4d, 0xe58d, 0xe58e, 0xdd4d, 0xdd4d, 0xdd8e, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5cf, 0xe5cf, 0xe5d0, 0xe5cf, 0xe5cf, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xdd8f, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5d0, 0xe5cf, 0xe5cf, 0xe5cf, 0xe58e, 0xe58e, 0xe58e, 0xe5ce, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5ce, 0xe5ce, 0xe5ce},
-  {0xdd8d, 0xdd4c, 0xdd4c, 0xdd4b, 0xe58c, 0xe58d, 0xe58d, 0xe58d, 0xdd8d, 0xd50c, 0xdd4d, 0xdd4e, 0xd50c, 0xd50c, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4e, 0xdd4e, 0xdd4d, 0xdd4e, 0xdd4e, 0xdd4e, 0xdd8e, 0xdd8e, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd8e, 0xe58e, 0xe58d, 0xdd4c, 0xdd4c, 0xdd0b, 0xd50b, 0xd50b, 0xdd4c, 0xdd4c, 0xdd4d, 0xdd4d, 0xdd8d, 0xdd8d, 0xdd8d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4c, 0xdd4d, 0xdd4d, 0xdd8d, 0xdd8d, 0xdd4d, 0xe58d, 0xdd4c, 0xdd4c, 0xdd4d, 0xdd8d, 0xdd8e, 0xe58e, 0xe58e, 0xdd8d, 0xe58d, 0xdd4d, 0xdd4d, 0xdd4c, 0xe58d, 0xe58d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd8d, 0xdd8e, 0xe58e, 0xdd8e, 0xd54e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xe58e, 0xe58f, 0xe5cf, 0xe58f, 0xe5cf, 0xe58f, 0xe58f, 0xe58f, 0xe5cf, 0xe5cf, 0xe5cf, 0xe58f, 0xe5cf, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe5cf, 0xe5cf, 0xe58f, 0xe58f, 0xe58f, 0xe5cf, 0xe5cf, 0xe5cf, 0xe58e, 0xe58d, 0xdd8d, 0xdd8e, 0xe5ce, 0xe5cf, 0xe5cf, 0xe5ce, 0xdd8e, 0xe58e, 0xdd8d},
-  {0xe58d, 0xdd4d, 0xdd4c, 0xd50b, 0xdd4b, 0xdd4c, 0xdd4c, 0xd50b, 0xdd4c, 0xd50d, 0xdd4d, 0xdd4e, 0xe58e, 0xe54e, 0xdd4e, 0xdd4e, 0xdd4e, 0xdd4d, 0xdd0d, 0xdd4d, 0xe58e, 0xe58e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd4e, 0xdd8e, 0xdd4e, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4e, 0xdd4d, 0xdd8e, 0xdd8e, 0xe58e, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd8d, 0xdd4d, 0xdd4c, 0xdd4d, 0xdd4c, 0xdd4c, 0xdd0c, 0xdd4c, 0xdd4c, 0xdd4d, 0xdd8d, 0xdd8e, 0xdd8e, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd8d, 0xe58e, 0xe58e, 0xe58e, 0xdd8d, 0xdd8d, 0xdd4d, 0xe58d, 0xe58d, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58d, 0xdd4d, 0xdd4d, 0xe58d, 0xe58d, 0xdd8d, 0xdd4d, 0xdd4d, 0xdd8d, 0xe58e, 0xe58e, 0xe58f, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd4e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58d, 0xe58d, 0xe54d, 0xdd4d, 0xdd8d, 0xe58e, 0xe58e, 0xdd4d, 0xe58d, 0xe54d, 0xdd4d, 0xdd4d, 0xdd4e, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4e, 0xdd4d, 0xdd4d, 0xe58e, 0xe58e, 0xdd4e, 0xdd0d, 0xdd0c, 0xd50c, 0xdd0c, 0xdd4d, 0xdd8e, 0xe58f, 0xdd8e, 0xe58e, 0xdd4d, 0xe58e},
-  {0xd50d, 0xd50e, 0xd50d, 0xcccc, 0xcccb, 0xcccb, 0xcccc, 0xcd0c, 0xcccc, 0xcd0e, 0xdd4f, 0xd54e, 0xd50d, 0xd54e, 0xdd4e, 0xdd8f, 0xdd90, 0xdd8f, 0xdd90, 0xdd8f, 0xd54f, 0xd54f, 0xd54f, 0xdd4f, 0xd54f, 0xdd4f, 0xd54e, 0xd54e, 0xd54e, 0xd54e, 0xd54e, 0xdd4e, 0xd54e, 0xd54e, 0xd54f, 0xdd4e, 0xdd8e, 0xdd8f, 0xdd8f, 0xdd4e, 0xdd4e, 0xd54e, 0xdd4e, 0xd54e, 0xd54e, 0xdd4e, 0xdd4e, 0xd54e, 0xdd4e, 0xd54d, 0xd54d, 0xdd4e, 0xdd4e, 0xdd4e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8f, 0xdd8e, 0xdd8e, 0xdd8f, 0xdd8f, 0xdd4e, 0xd54d, 0xd54d, 0xd54d, 0xd54d, 0xd54d, 0xd54d, 0xdd4d, 0xdd4e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd4e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd4e, 0xdd4f, 0xdd4f, 0xdd4e, 0xdd4e, 0xdd4f, 0xd50d, 0xd50c, 0xdd0d, 0xd50c, 0xdd0c, 0xd50c, 0xd50c, 0xd50c, 0xd4cc, 0xd4cc, 0xd50c, 0xd50d, 0xdd0d, 0xd50d, 0xd50d, 0xd50d, 0xd50d, 0xd54d, 0xdd4d, 0xdd4e, 0xdd4f, 0xdd4e, 0xdd4e, 0xdd4e, 0xdd4f, 0xdd4e, 0xdd4e, 0xdd4e, 0xdd4d, 0xdd4e, 0xdd4e, 0xdd4e, 0xd50e, 0xd50d, 0xd50d, 0xd50e, 0xd50e, 0xdd4e, 0xdd4e, 0xdd4f, 0xd54e, 0xd50d, 0xd50e},
-  {0xf654, 0xf694, 0xf654, 0xf654, 0xf654, 0xf694, 0xf653, 0xee53, 0xee53, 0xee53, 0xee54, 0xf654, 0xf694, 0xf654, 0xf653, 0xf653, 0xee54, 0xee53, 0xee53, 0xe654, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf694, 0xf654, 0xf654, 0xf654, 0xf654, 0xf694, 0xf694, 0xf694, 0xf654, 0xf654, 0xf694, 0xf694, 0xf654, 0xf654, 0xf654, 0xf654, 0xf654, 0xf654, 0xf653, 0xf653, 0xf653, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee13, 0xdd90, 0xdd90, 0xe5d0, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d0, 0xe5d1, 0xe5d1, 0xe5d1, 0xe611, 0xe611, 0xe611, 0xe5d1, 0xe611, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe611, 0xe611, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d0, 0xe5d1, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xdd90, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xddd0, 0xe612, 0xf694, 0xf694, 0xf695, 0xf694, 0xf694, 0xf654, 0xf653, 0xf653, 0xf654, 0xee53, 0xee53, 0xf654, 0xee53, 0xf654, 0xee54, 0xee54, 0xee53, 0xee54, 0xf654, 0xf694, 0xf694, 0xf695, 0xf695},
-  {0xee53, 0xddd0, 0xe5d1, 0xee12, 0xee53, 0xee53, 0xee53, 0xf653, 0xee53, 0xee53, 0xee53, 0xf653, 0xee53, 0xee53, 0xf653, 0xf653, 0xf653, 0xf654, 0xf694, 0xee54, 0xf6d6, 0xf6d6, 0xf696, 0xf696, 0xf696, 0xf696, 0xf696, 0xf696, 0xf695, 0xf695, 0xf695, 0xf696, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xee54, 0xf694, 0xee54, 0xee54, 0xdd90, 0xdd4f, 0xdd8f, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d1, 0xe5d0, 0xe5d1, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d1, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe612, 0xf653, 0xf654, 0xf694, 0xf654, 0xf654, 0xf653, 0xf653, 0xf653, 0xf654, 0xf654, 0xee53, 0xf653, 0xf694, 0xf654, 0xf654, 0xee53, 0xee53, 0xee53, 0xee53, 0xf654, 0xf694, 0xee54, 0xee53},
-  {0xf694, 0xf652, 0xf653, 0xf653, 0xf654, 0xf653, 0xf653, 0xee53, 0xee52, 0xee53, 0xf653, 0xf654, 0xf653, 0xf653, 0xee53, 0xf653, 0xf694, 0xee53, 0xee53, 0xee53, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xee94, 0xee94, 0xee94, 0xf694, 0xf694, 0xddd1, 0xdd8e, 0xdd8f, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5ce, 0xe5ce, 0xe58e, 0xdd8f, 0xe5cf, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xee11, 0xe610, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d1, 0xe611, 0xe5d1, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d1, 0xe5d1, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xdd8f, 0xddcf, 0xe5d0, 0xe5d0, 0xe5cf, 0xe5d1, 0xf654, 0xf654, 0xee53, 0xf654, 0xf694, 0xf694, 0xf695, 0xf695, 0xf694, 0xf654, 0xee53, 0xf654, 0xee54, 0xf654, 0xf694, 0xf694, 0xf694, 0xee54, 0xee54, 0xf654, 0xf694, 0xf694, 0xf694},
-  {0xf654, 0xee12, 0xee53, 0xee53, 0xf653, 0xf654, 0xf654, 0xf654, 0xee53, 0xe612, 0xee53, 0xf653, 0xee12, 0xee12, 0xee52, 0xf653, 0xf694, 0xf694, 0xf694, 0xee54, 0xf695, 0xf695, 0xf695, 0xf694, 0xf694, 0xf694, 0xf694, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xee95, 0xf694, 0xee94, 0xee94, 0xf695, 0xf694, 0xdd90, 0xdd4e, 0xe58e, 0xe58e, 0xe5ce, 0xe5ce, 0xe5ce, 0xe58e, 0xe58e, 0xe58e, 0xe5ce, 0xe5ce, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5ce, 0xe58e, 0xe58e, 0xe5ce, 0xe5cf, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xee10, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe612, 0xf695, 0xf694, 0xf695, 0xf695, 0xf695, 0xf695, 0xf694, 0xf694, 0xf694, 0xee12, 0xf654, 0xf695, 0xf695, 0xf695, 0xf694, 0xf694, 0xee54, 0xf654, 0xf695, 0xf695, 0xf695, 0xee54, 0xf694},
-  {0xee54, 0xee54, 0xee53, 0xee53, 0xf653, 0xee53, 0xee53, 0xf653, 0xf653, 0xf653, 0xee53, 0xf654, 0xf653, 0xf653, 0xf653, 0xf653, 0xee53, 0xee53, 0xee53, 0xe653, 0xf695, 0xf6d6, 0xf695, 0xee53, 0xf694, 0xf694, 0xf694, 0xf694, 0xf695, 0xf694, 0xf695, 0xf694, 0xee94, 0xf694, 0xf694, 0xf694, 0xf694, 0xee94, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xf695, 0xf695, 0xf695, 0xee94, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xee94, 0xee94, 0xee94, 0xee54, 0xee94, 0xee94, 0xf694, 0xf694, 0xddd0, 0xdd8e, 0xdd8d, 0xe58d, 0xe58d, 0xe58d, 0xe58d, 0xdd4c, 0xe58c, 0xe58d, 0xe58d, 0xe5ce, 0xe58e, 0xe58e, 0xe5ce, 0xe5cf, 0xe5cf, 0xe5cf, 0xe58e, 0xe58d, 0xe58e, 0xe5ce, 0xe5cf, 0xe5d0, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5d0, 0xe5d0, 0xe5d0, 0xdd8f, 0xe5cf, 0xe5d0, 0xe5cf, 0xe5cf, 0xe612, 0xee54, 0xf654, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xf654, 0xf654, 0xf654, 0xf654, 0xf694, 0xf654, 0xf654, 0xf654, 0xf695, 0xf654, 0xee54, 0xf694, 0xf654, 0xee54, 0xf654},
-  {0xee53, 0xf654, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee12, 0xee53, 0xf653, 0xee53, 0xf695, 0xf695, 0xf695, 0xf654, 0xf694, 0xf694, 0xf694, 0xf695, 0xf694, 0xf694, 0xf694, 0xf695, 0xf695, 0xf695, 0xf695, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xf695, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xdd90, 0xdd0d, 0xdd4c, 0xdd4c, 0xdd4d, 0xdd4c, 0xdd4c, 0xdd4b, 0xdd4c, 0xdd4c, 0xdd8d, 0xdd8d, 0xdd8e, 0xdd8e, 0xdd8e, 0xe5cf, 0xdd8e, 0xe58e, 0xdd8d, 0xdd4d, 0xdd4c, 0xdd4d, 0xdd8e, 0xe58f, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58f, 0xdd8e, 0xe58e, 0xe58e, 0xe58e, 0xdd8e, 0xe58e, 0xe58e, 0xe58e, 0xe58f, 0xe58f, 0xe58f, 0xe58e, 0xdd8e, 0xe5d1, 0xf653, 0xf654, 0xf653, 0xf653, 0xf653, 0xf653, 0xf654, 0xf654, 0xf654, 0xf654, 0xf694, 0xf654, 0xee54, 0xf654, 0xee53, 0xee54, 0xee54, 0xf653, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53},
-  {0xee11, 0xee11, 0xedd1, 0xee11, 0xee11, 0xee11, 0xee11, 0xee11, 0xee11, 0xee11, 0xedd1, 0xedd1, 0xee11, 0xee11, 0xedd0, 0xedd0, 0xedd0, 0xedd0, 0xedd0, 0xe612, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf694, 0xf695, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xdd90, 0xd4cb, 0xd50b, 0xd50b, 0xd50b, 0xd50b, 0xd50a, 0xd4ca, 0xdd0b, 0xdd4c, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4e, 0xdd8e, 0xe58e, 0xdd4e, 0xdd4d, 0xdd0d, 0xd4cc, 0xd50c, 0xdd0c, 0xdd4d, 0xdd8e, 0xdd8e, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd8d, 0xdd4d, 0xe58d, 0xdd8e, 0xe58e, 0xe58e, 0xdd8d, 0xdd8d, 0xdd4d, 0xdd4d, 0xdd4d, 0xe54d, 0xdd4d, 0xe5d0, 0xf653, 0xf612, 0xf652, 0xf653, 0xee12, 0xf652, 0xf612, 0xf612, 0xf612, 0xee12, 0xf612, 0xf612, 0xf612, 0xee12, 0xf611, 0xee11, 0xee11, 0xee11, 0xee11, 0xee11, 0xedd1, 0xedd0, 0xedd1},
-  {0xddd0, 0xdd90, 0xddd0, 0xdd90, 0xddd0, 0xe5d1, 0xddd1, 0xddd0, 0xdd90, 0xdd90, 0xe5d0, 0xdd90, 0xdd90, 0xdd90, 0xdd90, 0xe5d0, 0xe590, 0xe590, 0xdd90, 0xddd1, 0xe612, 0xe612, 0xe612, 0xe612, 0xe612, 0xe612, 0xe612, 0xe612, 0xe612, 0xe612, 0xe612, 0xe612, 0xe612, 0xe612, 0xe612, 0xe612, 0xe612, 0xe612, 0xddd1, 0xe5d1, 0xddd1, 0xe5d1, 0xddd1, 0xddd1, 0xddd1, 0xddd1, 0xe5d1, 0xe5d1, 0xddd1, 0xddd1, 0xddd1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xddd0, 0xddd0, 0xe5d1, 0xdd90, 0xddd0, 0xd54f, 0xd50d, 0xcd0c, 0xd50d, 0xd50d, 0xd50c, 0xcd0c, 0xd50d, 0xd50d, 0xd50d, 0xd50d, 0xd50e, 0xd54e, 0xd50d, 0xd54d, 0xd54e, 0xd54e, 0xd54d, 0xd50d, 0xd50d, 0xd50d, 0xd50d, 0xc48c, 0xc48b, 0xcccb, 0xcccb, 0xccca, 0xcc8a, 0xc48a, 0xcccb, 0xcccc, 0xcccc, 0xcccc, 0xcccc, 0xcccc, 0xcccc, 0xcccc, 0xd4cc, 0xd50c, 0xcccc, 0xcc8b, 0xcccc, 0xd50d, 0xd54f, 0xdd4f, 0xdd8f, 0xdd8f, 0xdd4f, 0xdd4f, 0xdd4e, 0xdd4f, 0xdd4f, 0xdd4f, 0xdd8f, 0xdd8f, 0xdd4f, 0xdd4e, 0xdd4e, 0xd50e, 0xdd4e, 0xdd4e, 0xdd4e, 0xdd4e, 0xdd90, 0xe5d0, 0xe5d0},
-  {0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d1, 0xe5d0, 0xe5d0, 0xddd0, 0xddd0, 0xddd0, 0xddd0, 0xe5d0, 0xe5d0, 0xe5d0, 0xddd0, 0xddd0, 0xe5d0, 0xddd0, 0xe5d0, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xdd4e, 0xdd4d, 0xdd4e, 0xdd4e, 0xdd4e, 0xdd8e, 0xdd8e, 0xe58e, 0xe58f, 0xe58e, 0xdd8e, 0xdd8e, 0xe58e, 0xdd8e, 0xdd8e, 0xdd8e, 0xe58e, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58e, 0xe58f, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58f, 0xe58f, 0xe58f, 0xe58e, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xd4cd, 0xd4cc, 0xd50b, 0xd50b, 0xd50b, 0xd50b, 0xd50a, 0xd4ca, 0xd50c, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4e, 0xe58e, 0xe58e, 0xdd4e, 0xdd4d, 0xd50c, 0xd50c, 0xd50c, 0xdd0c, 0xdd4d, 0xe58e, 0xe58e, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xe54e, 0xdd4d, 0xe54e, 0xe54e, 0xe58e, 0xe58e, 0xe54d, 0xe54d, 0xdd4d, 0xdd4d, 0xe54d, 0xe54d, 0xdd8f, 0xe5d0, 0xe5d0},
-  {0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5cf, 0xe5d0, 0xe5d0, 0xe5cf, 0xe5cf, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe611, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d1, 0xe5d1, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d1, 0xe5d1, 0xe5d1, 0xdd4e, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xe58f, 0xdd8e, 0xdd8e, 0xe58f, 0xe58e, 0xdd8e, 0xe58f, 0xdd8e, 0xe58f, 0xe58e, 0xdd4e, 0xdd4e, 0xdd4e, 0xdd4e, 0xe58e, 0xe58e, 0xdd4e, 0xdd4e, 0xdd4e, 0xdd4e, 0xdd4e, 0xdd4e, 0xdd4e, 0xdd4e, 0xdd4e, 0xdd4e, 0xe58e, 0xdd8e, 0xdd8e, 0xdd4e, 0xe58e, 0xdd8e, 0xdd8f, 0xe58e, 0xd50d, 0xd54c, 0xdd4c, 0xdd4c, 0xdd4c, 0xdd4c, 0xdd4c, 0xdd4b, 0xdd4c, 0xdd4c, 0xdd8d, 0xdd8d, 0xdd8d, 0xe58e, 0xdd8e, 0xe5cf, 0xdd8e, 0xe58e, 0xe58d, 0xdd4d, 0xdd4d, 0xdd8d, 0xe58e, 0xe58f, 0xe58f, 0xdd8e, 0xe58e, 0xdd8e, 0xdd8e, 0xdd8e, 0xe58f, 0xe58f, 0xdd8e, 0xdd8e, 0xe58e, 0xe58e, 0xe58f, 0xe58f, 0xe58f, 0xe58e, 0xe58e, 0xdd8f, 0xe5d0, 0xe5d0},
-  {0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5cf, 0xe5cf, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5cf, 0xe5d0, 0xdd8f, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5d0, 0xe610, 0xe5d0, 0xe5d0, 0xe5d0, 0xdd8f, 0xe58f, 0xe58f, 0xdd8f, 0xdd8f, 0xdd8e, 0xdd8e, 0xe58f, 0xe58f, 0xe58e, 0xdd8e, 0xdd8e, 0xe58e, 0xdd8e, 0xdd8e, 0xd54d, 0xdd4e, 0xdd4e, 0xe58e, 0xdd8e, 0xdd8e, 0xdd4e, 0xdd4e, 0xdd8e, 0xe58e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd4e, 0xe58e, 0xdd8e, 0xe58e, 0xdd8e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd4e, 0xdd4e, 0xdd8e, 0xe58e, 0xe58e, 0xe58e, 0xd50d, 0xdd8d, 0xdd8d, 0xe58d, 0xe58d, 0xe58d, 0xe58d, 0xdd4c, 0xdd8d, 0xdd8d, 0xe58d, 0xe58e, 0xe5ce, 0xe5ce, 0xe5ce, 0xe5cf, 0xe5cf, 0xe5ce, 0xe58e, 0xdd8d, 0xe58e, 0xe5ce, 0xe5cf, 0xe5d0, 0xe5d0, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5d0, 0xe5d0, 0xe5d0, 0xdd8f, 0xe5cf, 0xe5cf, 0xe5d0, 0xdd8f, 0xe5d0, 0xe5d0},
-  {0xe5d0, 0xe5d0, 0xe5cf, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xdd8f, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5cf, 0xe58e, 0xe58e, 0xe58e, 0xe5ce, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xdd4e, 0xe58e, 0xe58e, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd8d, 0xe58e, 0xdd4e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd4e, 0xdd4e, 0xdd8e, 0xdd8e, 0xdd4d, 0xdd4e, 0xdd4e, 0xdd4e, 0xdd4e, 0xdd4d, 0xdd4e, 0xe58e, 0xe58f, 0xe58f, 0xe58f, 0xe58e, 0xdd8e, 0xe58e, 0xdd8e, 0xdd8e, 0xdd8e, 0xe58e, 0xdd4e, 0xdd4e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd4e, 0xdd4d, 0xdd4d, 0xd50d, 0xd50c, 0xcd0d, 0xdd4d, 0xe58e, 0xe58e, 0xe58e, 0xe5ce, 0xe5ce, 0xe58d, 0xe58e, 0xe5ce, 0xe5ce, 0xe5ce, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5ce, 0xe58e, 0xdd8e, 0xe5ce, 0xe5cf, 0xe5cf, 0xe5d0, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xdd8f, 0xe5d0, 0xe5d0},
-  {0xe58e, 0xe58f, 0xe58f, 0xe58e, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xdd8f, 0xe5cf, 0xe58f, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe58f, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe58e, 0xe58e, 0xdd8d, 0xe58e, 0xe5ce, 0xe5cf, 0xe5cf, 0xe5ce, 0xe58e, 0xdd4e, 0xe58e, 0xe58e, 0xe58f, 0xe58f, 0xe58f, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe590, 0xe5cf, 0xe58f, 0xe5cf, 0xe5d0, 0xe5cf, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58e, 0xe58f, 0xe58e, 0xdd8e, 0xdd8e, 0xe58e, 0xe58e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xe58e, 0xe58f, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xdd8e, 0xdd8e, 0xdd8e, 0xd54e, 0xdd8e, 0xe58f, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5ce, 0xe5ce, 0xdd8e, 0xdd8e, 0xe5cf, 0xe5d0, 0xe5d0, 0xe5d0, 0xe610, 0xe611, 0xe610, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe611, 0xe611, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d1, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xdd8f, 0xe5d0, 0xe5d0, 0xe5d0, 0xd58e, 0xdd8e, 0xdd8f},
-  {0xe58e, 0xe58e, 0xdd8e, 0xdd4d, 0xdd8d, 0xdd8d, 0xdd4d, 0xe58e, 0xe58e, 0xe58e, 0xe54e, 0xe58e, 0xdd8e, 0xdd4d, 0xdd4e, 0xdd4e, 0xdd4e, 0xdd4e, 0xe58e, 0xe58e, 0xdd4e, 0xdd4e, 0xdd4e, 0xdd4e, 0xdd4d, 0xdd4d, 0xdd8e, 0xdd8e, 0xdd4e, 0xdd4d, 0xdd0c, 0xd50c, 0xdd4d, 0xdd4d, 0xdd8e, 0xe5cf, 0xdd8e, 0xe58e, 0xe590, 0xedd1, 0xedd1, 0xedd1, 0xee11, 0xee11, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d0, 0xe5d0, 0xe590, 0xe590, 0xe5d0, 0xe5cf, 0xe5cf, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58e, 0xe58e, 0xdd4d, 0xdd4e, 0xdd4e, 0xdd4e, 0xdd4e, 0xdd4d, 0xdd4e, 0xdd4d, 0xdd0d, 0xd50d, 0xdd0d, 0xd50d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4e, 0xd50e, 0xdd8f, 0xe58f, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d1, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d1, 0xe611, 0xe5d0, 0xe5d0, 0xe5d0, 0xddd0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d1, 0xdd8e, 0xe58e, 0xe58e},
-  {0xd50c, 0xdd0c, 0xd50c, 0xdd0c, 0xdd0c, 0xd4cb, 0xd4cb, 0xd50c, 0xdd0c, 0xdd0c, 0xd50c, 0xdd0c, 0xdd0d, 0xdd0c, 0xdd0d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xd50d, 0xd50c, 0xd50d, 0xdd4e, 0xdd4e, 0xd50d, 0xd50c, 0xcccc, 0xcccc, 0xd4cc, 0xd4cc, 0xd50d, 0xdd4d, 0xd54d, 0xd50d, 0xe5d1, 0xe612, 0xe612, 0xe612, 0xe613, 0xe612, 0xe612, 0xe612, 0xe613, 0xe613, 0xe613, 0xe613, 0xe613, 0xe613, 0xe613, 0xe612, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe590, 0xe58f, 0xdd8f, 0xdd8e, 0xdd4e, 0xdd4f, 0xdd4e, 0xdd4e, 0xd54e, 0xd54e, 0xd54e, 0xd54d, 0xd50d, 0xd50d, 0xd50d, 0xd50d, 0xd50d, 0xd54e, 0xdd4e, 0xd50e, 0xdd8f, 0xdd90, 0xddd0, 0xddd0, 0xddd0, 0xddd0, 0xddd0, 0xddd0, 0xddd0, 0xddd0, 0xe5d0, 0xe5d0, 0xe5d0, 0xddd0, 0xddd0, 0xddd0, 0xddd0, 0xddd0, 0xddd0, 0xddd0, 0xddd0, 0xddd1, 0xe5d1, 0xe5d1, 0xddd0, 0xddd0, 0xdd90, 0xddd0, 0xdd90, 0xdd90, 0xdd90, 0xdd90, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd90, 0xdd8f, 0xdd8f, 0xdd90, 0xd50d, 0xd50c, 0xdd0c},
-  {0xdd4d, 0xdd4d, 0xdd0c, 0xdd4d, 0xdd0c, 0xdd4d, 0xdd0c, 0xdd0c, 0xdd0c, 0xd4cb, 0xd4cb, 0xdd0c, 0xdd0c, 0xdd0c, 0xdd0c, 0xdd4c, 0xdd0c, 0xd50c, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4e, 0xdd4d, 0xdd4e, 0xdd4d, 0xdd0d, 0xd50c, 0xdd4d, 0xdd4e, 0xdd4d, 0xd50c, 0xd50c, 0xd4cc, 0xcccc, 0xd4cc, 0xd54e, 0xe58f, 0xe58f, 0xdd8e, 0xdd8e, 0xe58f, 0xdd8f, 0xe58f, 0xe58f, 0xdd8f, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d1, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe590, 0xe5d0, 0xe5d0, 0xe5d0, 0xe590, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe590, 0xdd8f, 0xe58f, 0xdd8f, 0xd54e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8f, 0xdd8f, 0xdd8f, 0xe58f, 0xe58f, 0xe58f, 0xdd8f, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd4e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xe58f, 0xdd8e, 0xdd8e, 0xdd8e, 0xe58f, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8f, 0xdd8e, 0xdd8f, 0xe58f, 0xdd8e, 0xe58e, 0xdd8e, 0xdd8e, 0xdd8e, 0xe58e, 0xe58e, 0xdd8e, 0xdd8e, 0xdd4e, 0xdd8e, 0xe58e, 0xe58e},
-  {0xdd4d, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe54d, 0xe58d, 0xe58d, 0xdd4d, 0xdd4d, 0xdd4d, 0xe58e, 0xe54d, 0xe58d, 0xe54d, 0xe54d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4e, 0xdd4e, 0xdd4e, 0xdd4d, 0xdd4e, 0xdd4d, 0xe54d, 0xe58e, 0xdd4e, 0xdd0d, 0xdd0c, 0xd50c, 0xd50c, 0xdd4d, 0xdd90, 0xe611, 0xee11, 0xee11, 0xee11, 0xee11, 0xe5d1, 0xe5d1, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d1, 0xe611, 0xe611, 0xe611, 0xe611, 0xee11, 0xe611, 0xe611, 0xe611, 0xee11, 0xe611, 0xee11, 0xee12, 0xee11, 0xe611, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee11, 0xe5d1, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8f, 0xdd8f, 0xe58f, 0xdd8f, 0xdd8f, 0xdd8e, 0xe58f, 0xe58f, 0xdd4e, 0xdd4e, 0xe58e, 0xe58f, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xdd8e, 0xdd8e, 0xdd8e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xdd8e, 0xdd8e, 0xdd8e, 0xe58e, 0xe58d, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xdd8d, 0xe58e, 0xe58e, 0xe58e, 0xe58e},
-  {0xdd4d, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xe58e, 0xdd8e, 0xe58e, 0xe58e, 0xe5cf, 0xe58f, 0xe58f, 0xe5cf, 0xe58f, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe58f, 0xe58f, 0xe5cf, 0xe58f, 0xe58f, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe58f, 0xe58f, 0xe5cf, 0xe5cf, 0xe5cf, 0xe58e, 0xe58e, 0xdd8d, 0xdd8d, 0xe58e, 0xddd0, 0xe612, 0xee12, 0xee12, 0xe611, 0xee12, 0xee12, 0xee11, 0xe611, 0xe612, 0xe612, 0xe611, 0xe611, 0xe611, 0xe611, 0xe611, 0xe611, 0xe611, 0xe5d1, 0xe611, 0xe5d0, 0xddd0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe611, 0xe611, 0xe611, 0xe611, 0xee11, 0xe611, 0xe5d1, 0xe5d1, 0xe611, 0xe5d1, 0xe5d1, 0xdd8f, 0xdd8f, 0xdd8e, 0xdd8f, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd4d, 0xdd4d, 0xdd8e, 0xdd8e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xdd8e, 0xdd8e, 0xdd8e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xdd8e, 0xe58e, 0xe58e, 0xe58e, 0xdd8e, 0xdd4d, 0xdd8e, 0xdd8e, 0xe58e, 0xdd8e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xdd8e, 0xe58e, 0xdd8e, 0xdd8d, 0xdd8d, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e},
-  {0xdd8e, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5cf, 0xe5d0, 0xe5cf, 0xe5cf, 0xe5d0, 0xe5cf, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xdd8f, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5cf, 0xe5ce, 0xe58e, 0xe58e, 0xe5ce, 0xddd0, 0xe612, 0xe611, 0xe611, 0xe611, 0xe611, 0xe611, 0xe611, 0xe611, 0xe611, 0xee11, 0xee12, 0xee11, 0xee12, 0xee12, 0xee11, 0xee11, 0xee12, 0xee52, 0xee12, 0xee12, 0xee12, 0xee12, 0xee52, 0xe611, 0xe5d0, 0xee11, 0xee12, 0xee12, 0xee11, 0xe611, 0xee12, 0xe612, 0xe612, 0xe612, 0xe612, 0xee12, 0xdd8f, 0xe58f, 0xdd8f, 0xe58f, 0xe5cf, 0xe5cf, 0xe5cf, 0xdd8f, 0xe58f, 0xe58f, 0xe58f, 0xe5cf, 0xdd8e, 0xe58e, 0xe58e, 0xe58e, 0xe58f, 0xe58e, 0xe58e, 0xe58e, 0xdd8e, 0xe58e, 0xe58e, 0xdd8f, 0xdd8e, 0xe58f, 0xe58e, 0xe58e, 0xe58e, 0xdd8e, 0xdd8e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xdd8e, 0xdd8e, 0xdd8e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xdd8e, 0xe58e, 0xe58e, 0xe58e, 0xe58d, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e},
-  {0xdd8e, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5d0, 0xee12, 0xee12, 0xee12, 0xee12, 0xee11, 0xee12, 0xee11, 0xee12, 0xee12, 0xee52, 0xee12, 0xee12, 0xee12, 0xee52, 0xee52, 0xe612, 0xe612, 0xe612, 0xe612, 0xee12, 0xee52, 0xee52, 0xee52, 0xee11, 0xee11, 0xee52, 0xe611, 0xe612, 0xe612, 0xee52, 0xee52, 0xee52, 0xee52, 0xee52, 0xee53, 0xe612, 0xdd8e, 0xe58e, 0xdd8e, 0xe58f, 0xe5cf, 0xdd8f, 0xe58f, 0xe58e, 0xdd8e, 0xdd8e, 0xdd8e, 0xe58e, 0xe58e, 0xe58f, 0xe58f, 0xe58f, 0xe5cf, 0xe58f, 0xe5cf, 0xe5cf, 0xe5cf, 0xe58f, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe58f, 0xe5cf, 0xe5cf, 0xe5cf, 0xe58f, 0xe5cf, 0xe58e, 0xe58f, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xdd8e},
-  {0xdd8e, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5cf, 0xe5d0, 0xddcf, 0xe5cf, 0xddcf, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d1, 0xe5d0, 0xe5d0, 0xe5d1, 0xe611, 0xe611, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xddd0, 0xe611, 0xe611, 0xe611, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xe612, 0xe612, 0xee12, 0xee12, 0xee12, 0xee11, 0xee12, 0xee52, 0xee13, 0xe612, 0xe611, 0xe611, 0xe611, 0xe611, 0xe611, 0xe611, 0xe611, 0xe611, 0xee12, 0xee12, 0xe612, 0xe612, 0xe612, 0xee12, 0xee12, 0xee12, 0xee52, 0xe612, 0xdd8e, 0xe58e, 0xdd8e, 0xe5cf, 0xe5cf, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xdd8e, 0xe58f, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe58f, 0xe58f, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe58f, 0xe5cf, 0xe5cf, 0xe5cf, 0xe58f, 0xe5cf, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe5cf, 0xe58f, 0xe58f, 0xe58f, 0xe58e, 0xe58e, 0xe58e},
-  {0xdd8f, 0xe5d0, 0xe5cf, 0xe5d0, 0xddcf, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xddd0, 0xddd0, 0xdd90, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xddd0, 0xddd0, 0xe5d0, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d1, 0xe5d1, 0xe5d1, 0xe611, 0xee52, 0xee52, 0xee52, 0xee12, 0xee11, 0xe611, 0xee11, 0xee11, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xe612, 0xee52, 0xe612, 0xee12, 0xee12, 0xe611, 0xe611, 0xe612, 0xe612, 0xee12, 0xee12, 0xee52, 0xee52, 0xe612, 0xe612, 0xee52, 0xee53, 0xee12, 0xee12, 0xee53, 0xee12, 0xdd8e, 0xe58e, 0xdd4d, 0xe58e, 0xe58d, 0xe58d, 0xe58d, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xdd8e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe5ce, 0xe58e, 0xe5ce, 0xe5ce, 0xe5cf, 0xe5cf, 0xe5ce, 0xe5ce, 0xe58e, 0xe58f, 0xe58f, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf},
-  {0xddd1, 0xe5d2, 0xe5d2, 0xddd1, 0xddd1, 0xddd1, 0xddd1, 0xddd1, 0xddd1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xddd1, 0xddd1, 0xddd1, 0xddd1, 0xddd1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe612, 0xe612, 0xe5d1, 0xe5d2, 0xe5d1, 0xe5d2, 0xe5d2, 0xe5d2, 0xe5d2, 0xe612, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d2, 0xe5d2, 0xe612, 0xe5d1, 0xddd1, 0xe5d1, 0xe611, 0xe611, 0xe611, 0xe611, 0xe611, 0xe611, 0xe611, 0xe612, 0xe612, 0xe612, 0xe612, 0xe612, 0xe612, 0xe612, 0xe611, 0xe5d1, 0xe5d1, 0xe5d1, 0xe611, 0xddd1, 0xe611, 0xe5d1, 0xe611, 0xe611, 0xe611, 0xe611, 0xe611, 0xddd2, 0xe612, 0xe612, 0xe612, 0xe5d2, 0xddd0, 0xddd0, 0xddd0, 0xe5d0, 0xe5d1, 0xe5d1, 0xe5d1, 0xddd1, 0xe5d1, 0xe5d0, 0xe5d1, 0xe5d1, 0xe5d0, 0xddd0, 0xe5d0, 0xe5d0, 0xddd0, 0xddd1, 0xddd0, 0xddd0, 0xe5d0, 0xddd0, 0xddd0, 0xe5d1, 0xddd1, 0xddd0, 0xddd0, 0xddd0, 0xddd0, 0xddd0, 0xddd0, 0xddd0, 0xdd90, 0xddd0, 0xddd0, 0xddd0, 0xddd1, 0xddd1, 0xddd0, 0xdd90, 0xddd0, 0xddd0, 0xe5d0, 0xe5d1, 0xe5d1, 0xdd90, 0xdd90, 0xdd90, 0xdd90, 0xdd90, 0xdd90, 0xddd1, 0xddd1, 0xe5d1},
-  {0xee53, 0xe613, 0xe612, 0xddd1, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee52, 0xee12, 0xee12, 0xee52, 0xee52, 0xee52, 0xee52, 0xee52, 0xee52, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee52, 0xee52, 0xee12, 0xee11, 0xee12, 0xee11, 0xe611, 0xe5d1, 0xe611, 0xee11, 0xee11, 0xe611, 0xe611, 0xee12, 0xee12, 0xee12, 0xee52, 0xee12, 0xee12, 0xee12, 0xee52, 0xee12, 0xee52, 0xee52, 0xee52, 0xee52, 0xee52, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee52, 0xee12, 0xe611, 0xee12, 0xee52, 0xee12, 0xee12, 0xee11, 0xee11, 0xe611, 0xee12, 0xee12, 0xee12, 0xe612, 0xee53, 0xee52, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee13, 0xee53, 0xee53, 0xee53, 0xee53, 0xee13, 0xee13, 0xee13, 0xee13, 0xee12, 0xee13, 0xee13, 0xee13, 0xee13, 0xe613, 0xe613, 0xee13, 0xee13, 0xee13, 0xee53, 0xee53, 0xee53, 0xee13, 0xee12, 0xe612, 0xe612, 0xe612, 0xe612, 0xe612, 0xe612, 0xe612, 0xe612, 0xe612, 0xee13, 0xe612, 0xee13, 0xe612, 0xee12, 0xe612, 0xe613, 0xee13, 0xe613, 0xee13, 0xee13, 0xee12, 0xee12, 0xee13, 0xe613, 0xee13, 0xee13},
-  {0xe5d1, 0xe611, 0xe612, 0xe611, 0xee52, 0xee52, 0xee12, 0xee52, 0xee52, 0xee12, 0xee12, 0xe611, 0xee11, 0xee12, 0xe611, 0xe611, 0xee12, 0xee12, 0xee52, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee52, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee52, 0xee11, 0xee11, 0xe611, 0xee11, 0xee11, 0xee11, 0xee11, 0xe611, 0xee51, 0xee11, 0xee11, 0xee11, 0xee52, 0xee52, 0xee12, 0xee52, 0xee52, 0xee12, 0xee12, 0xee11, 0xee11, 0xee11, 0xee11, 0xee52, 0xee52, 0xee12, 0xe611, 0xee12, 0xee12, 0xee52, 0xee11, 0xe612, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee52, 0xee12, 0xee12, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee52, 0xee52, 0xee52, 0xee12, 0xee53, 0xee53, 0xe612, 0xe612, 0xee12, 0xe612, 0xee53, 0xee12, 0xee12, 0xe612, 0xe611, 0xe612, 0xe612, 0xee12, 0xee13, 0xee13, 0xe612, 0xe612, 0xe612, 0xee12, 0xee13, 0xe612, 0xee12, 0xee13, 0xee13, 0xee53, 0xee13, 0xee12, 0xee12, 0xee53, 0xee53, 0xee13, 0xee13, 0xee13, 0xee53, 0xee13, 0xe612},
-  {0xe612, 0xee12, 0xe612, 0xe5d1, 0xee11, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee52, 0xee12, 0xee12, 0xee52, 0xee52, 0xee12, 0xee52, 0xee12, 0xee52, 0xee12, 0xee52, 0xee12, 0xee12, 0xee12, 0xee12, 0xee11, 0xee11, 0xee11, 0xee11, 0xee12, 0xee52, 0xee12, 0xee52, 0xee52, 0xee12, 0xee12, 0xee11, 0xee11, 0xee11, 0xee11, 0xee11, 0xee12, 0xee52, 0xee52, 0xee11, 0xee11, 0xee11, 0xee11, 0xee11, 0xee11, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee52, 0xee52, 0xee52, 0xee52, 0xee52, 0xe611, 0xe611, 0xee53, 0xee53, 0xee53, 0xee52, 0xe611, 0xee52, 0xee52, 0xee52, 0xee52, 0xee52, 0xee52, 0xee12, 0xee11, 0xee12, 0xee12, 0xee52, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee12, 0xee53, 0xee52, 0xee52, 0xee52, 0xee53, 0xee12, 0xe5d0, 0xee12, 0xee52, 0xee52, 0xee12, 0xe611, 0xe611, 0xee12, 0xee12, 0xee12, 0xee12, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xe612, 0xe612, 0xee53, 0xee53, 0xee13, 0xee53, 0xee53, 0xee53, 0xee53, 0xee12, 0xe612, 0xee53, 0xee53, 0xee13, 0xee12, 0xee12, 0xe5d1, 0xe612, 0xe612},
-  {0xee53, 0xee53, 0xee53, 0xe611, 0xee52, 0xee52, 0xee52, 0xee12, 0xee12, 0xee12, 0xee11, 0xee12, 0xee11, 0xee11, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee52, 0xee11, 0xe611, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee52, 0xee12, 0xee12, 0xee52, 0xee52, 0xee52, 0xee12, 0xee11, 0xee52, 0xee52, 0xee52, 0xdd8f, 0xee11, 0xee52, 0xee12, 0xee52, 0xee12, 0xee12, 0xee52, 0xee52, 0xee52, 0xee52, 0xee53, 0xee53, 0xee53, 0xee53, 0xee12, 0xee53, 0xee53, 0xe5d0, 0xedd0, 0xe611, 0xee53, 0xee53, 0xee54, 0xee53, 0xe5d1, 0xe5d0, 0xedd0, 0xe611, 0xee12, 0xee12, 0xee12, 0xee12, 0xee52, 0xee52, 0xee12, 0xee12, 0xee52, 0xee52, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee52, 0xee12, 0xee12, 0xee12, 0xee12, 0xee52, 0xee12, 0xee12, 0xee12, 0xee52, 0xee12, 0xe612, 0xee12, 0xee53, 0xee53, 0xee53, 0xee53, 0xee13, 0xe612, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee13, 0xee13, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xe5d1, 0xee11, 0xee53, 0xee53},
-  {0xee53, 0xee53, 0xee53, 0xddd1, 0xee12, 0xee52, 0xee53, 0xee53, 0xee53, 0xee52, 0xee52, 0xee12, 0xee12, 0xee11, 0xe611, 0xe611, 0xee12, 0xee12, 0xee12, 0xee11, 0xee11, 0xee11, 0xee12, 0xee52, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee11, 0xee12, 0xee12, 0xee12, 0xee12, 0xee52, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee11, 0xee11, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee52, 0xee52, 0xee52, 0xee52, 0xee53, 0xee53, 0xee53, 0xee53, 0xee11, 0xee12, 0xee53, 0xe5d0, 0xe5d0, 0xdd90, 0xee12, 0xee53, 0xee53, 0xee53, 0xe5d1, 0xee11, 0xee11, 0xee12, 0xee52, 0xee12, 0xee52, 0xee52, 0xee11, 0xe611, 0xee52, 0xee12, 0xee52, 0xee52, 0xee12, 0xee52, 0xee52, 0xee12, 0xee52, 0xee52, 0xee13, 0xee52, 0xee53, 0xee12, 0xee12, 0xe612, 0xee12, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee13, 0xee53, 0xee53, 0xee53, 0xee53, 0xee13, 0xee13, 0xee13, 0xee12, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee13, 0xe612, 0xe613, 0xee53},
-  {0xee54, 0xee54, 0xee53, 0xe5d1, 0xee12, 0xe611, 0xee12, 0xee53, 0xee52, 0xee52, 0xee53, 0xee12, 0xee12, 0xee12, 0xe611, 0xee52, 0xee52, 0xee12, 0xee11, 0xe611, 0xee12, 0xee12, 0xee11, 0xee11, 0xee12, 0xee52, 0xee11, 0xee11, 0xee52, 0xee52, 0xee52, 0xee52, 0xee52, 0xee52, 0xee52, 0xee52, 0xee12, 0xee12, 0xe612, 0xee12, 0xee12, 0xee12, 0xee12, 0xee52, 0xee52, 0xee12, 0xee52, 0xee52, 0xee12, 0xe612, 0xee12, 0xee53, 0xee52, 0xee52, 0xee52, 0xee53, 0xee53, 0xee53, 0xee11, 0xee10, 0xe5d0, 0xee11, 0xedd0, 0xe610, 0xee12, 0xee12, 0xee53, 0xee53, 0xee52, 0xe611, 0xee52, 0xee52, 0xee52, 0xee52, 0xee52, 0xee12, 0xee11, 0xe611, 0xee12, 0xee12, 0xee12, 0xee12, 0xee11, 0xee11, 0xee12, 0xee12, 0xee11, 0xee11, 0xee12, 0xee53, 0xedd1, 0xee11, 0xee52, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee13, 0xee13, 0xee13, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xe613, 0xee53, 0xee53, 0xee54, 0xee53, 0xee53, 0xee53, 0xee53, 0xee13, 0xe612, 0xee12, 0xee12, 0xe612, 0xe612, 0xe612, 0xee12, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53},
-  {0xe613, 0xee13, 0xe612, 0xddd1, 0xe611, 0xe612, 0xe611, 0xe612, 0xee53, 0xee12, 0xe612, 0xe612, 0xe612, 0xee12, 0xee13, 0xe612, 0xe611, 0xee12, 0xee52, 0xee12, 0xe611, 0xe611, 0xe611, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xe611, 0xee12, 0xee12, 0xee12, 0xee12, 0xe612, 0xee12, 0xe612, 0xee13, 0xee12, 0xee12, 0xe5d1, 0xe5d1, 0xe5d1, 0xe611, 0xe611, 0xe611, 0xe611, 0xe612, 0xe612, 0xe612, 0xe612, 0xe612, 0xe612, 0xe612, 0xe612, 0xe612, 0xe612, 0xe612, 0xe611, 0xe5d0, 0xe5d0, 0xe5d0, 0xe590, 0xe5d0, 0xe612, 0xe612, 0xe612, 0xe612, 0xe612, 0xe612, 0xee53, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe611, 0xe611, 0xe611, 0xe611, 0xe612, 0xe611, 0xe611, 0xe611, 0xe612, 0xee13, 0xe5d2, 0xe5d1, 0xe5d1, 0xe5d1, 0xe612, 0xe612, 0xe612, 0xe613, 0xee53, 0xee53, 0xee53, 0xee13, 0xe613, 0xe612, 0xe612, 0xe612, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee13, 0xe612, 0xe612, 0xe612, 0xe613, 0xee13, 0xe613, 0xe612, 0xee13, 0xee13, 0xee13, 0xe612, 0xe612, 0xe612, 0xe612, 0xe612, 0xe612},
-  {0xddd1, 0xe5d1, 0xe5d1, 0xe5d0, 0xe5d1, 0xe5d1, 0xe5d0, 0xe5d0, 0xe5d0, 0xe590, 0xe5d0, 0xdd90, 0xe590, 0xe590, 0xe5d0, 0xdd90, 0xdd8f, 0xe58f, 0xdd8f, 0xdd8f, 0xe58f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xe590, 0xe590, 0xe5d0, 0xe5d0, 0xdd8f, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d1, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5cf, 0xe5d0, 0xe5d0, 0xe58f, 0xdd8f, 0xe58f, 0xe58f, 0xdd8f, 0xdd8f, 0xdd8e, 0xdd8f, 0xe58f, 0xe58f, 0xe613, 0xee53, 0xee12, 0xee12, 0xe612, 0xee12, 0xee11, 0xe611, 0xee12, 0xee12, 0xe611, 0xee12, 0xee12, 0xee12, 0xe612, 0xe612, 0xe5d0, 0xe5d0, 0xddd0, 0xe5d1, 0xe5d0, 0xe611, 0xe612, 0xe611, 0xe611, 0xe611, 0xe611, 0xe612, 0xe612, 0xe611, 0xe5d1, 0xe611, 0xe611, 0xe5d1, 0xe611, 0xddd1, 0xe5d1, 0xe5d1, 0xddd0, 0xe5d1, 0xe612, 0xe612, 0xee53, 0xe613, 0xe612, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xe612, 0xe612, 0xe612, 0xe612, 0xe611, 0xee12, 0xee52, 0xe612, 0xe612, 0xe612, 0xee12, 0xee13, 0xee13, 0xe611, 0xe5d1, 0xee12, 0xee53, 0xee53, 0xe612, 0xe611, 0xee12},
-  {0xe5d1, 0xee12, 0xee12, 0xe611, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe611, 0xee12, 0xee12, 0xee12, 0xee11, 0xe611, 0xee11, 0xe611, 0xee11, 0xee12, 0xee12, 0xee12, 0xee12, 0xe611, 0xe611, 0xee11, 0xee11, 0xee11, 0xee11, 0xe611, 0xe611, 0xe611, 0xee11, 0xe611, 0xe611, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d0, 0xe5d0, 0xe590, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe611, 0xe611, 0xe611, 0xe611, 0xe611, 0xe611, 0xe611, 0xe613, 0xf653, 0xee52, 0xee52, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xe611, 0xee52, 0xee52, 0xee53, 0xee12, 0xe612, 0xe611, 0xe5d0, 0xee11, 0xe610, 0xe610, 0xe611, 0xee12, 0xee53, 0xee53, 0xee52, 0xe612, 0xee52, 0xee52, 0xee12, 0xee12, 0xee52, 0xee52, 0xee52, 0xee12, 0xee52, 0xee12, 0xee11, 0xee11, 0xee12, 0xee52, 0xee12, 0xee52, 0xee12, 0xee12, 0xee12, 0xee12, 0xee52, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee52, 0xee12, 0xee12, 0xee52, 0xee52, 0xee11, 0xe611, 0xee12, 0xee52, 0xee52, 0xee12, 0xee12, 0xee12, 0xee53, 0xee53, 0xee52, 0xee12, 0xee13, 0xee53, 0xee12, 0xee11},
-  {0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe611, 0xee12, 0xee52, 0xee12, 0xee12, 0xe612, 0xee12, 0xee52, 0xe612, 0xee12, 0xe611, 0xe611, 0xe611, 0xe611, 0xe611, 0xe611, 0xe611, 0xe611, 0xe611, 0xe611, 0xe611, 0xe611, 0xe611, 0xe611, 0xddcf, 0xe5d0, 0xe5d0, 0xddd0, 0xdd8f, 0xe5d0, 0xe611, 0xe611, 0xe611, 0xe611, 0xe611, 0xee12, 0xe611, 0xe611, 0xe611, 0xee12, 0xe612, 0xe611, 0xe611, 0xee12, 0xe611, 0xe611, 0xee12, 0xee12, 0xe612, 0xe612, 0xee12, 0xee12, 0xee11, 0xee12, 0xee52, 0xee52, 0xee52, 0xee52, 0xee52, 0xee52, 0xee53, 0xee53, 0xee54, 0xee12, 0xe5d1, 0xedd0, 0xe5d0, 0xee52, 0xe611, 0xee11, 0xee52, 0xee53, 0xee53, 0xee53, 0xee53, 0xee52, 0xee52, 0xee52, 0xee12, 0xee12, 0xee12, 0xee52, 0xee11, 0xee11, 0xe611, 0xee12, 0xee11, 0xee11, 0xee11, 0xee11, 0xee12, 0xee52, 0xee52, 0xee12, 0xee11, 0xee12, 0xee11, 0xee12, 0xee11, 0xee12, 0xee52, 0xee11, 0xee11, 0xee11, 0xee52, 0xee12, 0xee11, 0xee12, 0xee11, 0xee11, 0xee11, 0xee11, 0xee11, 0xe611, 0xe611, 0xee12, 0xee52, 0xee12, 0xee52, 0xee52, 0xee53, 0xee53, 0xee52, 0xee12},
-  {0xddd0, 0xe5d1, 0xee12, 0xee12, 0xee12, 0xee12, 0xee53, 0xee13, 0xe612, 0xee12, 0xee12, 0xee12, 0xe612, 0xe612, 0xe612, 0xe611, 0xe612, 0xee52, 0xe612, 0xe612, 0xe612, 0xe612, 0xe612, 0xe611, 0xee11, 0xee12, 0xee12, 0xee11, 0xe5d0, 0xe611, 0xee52, 0xee52, 0xee12, 0xee52, 0xee12, 0xee12, 0xe611, 0xe611, 0xe611, 0xe612, 0xe611, 0xee12, 0xee12, 0xe612, 0xe612, 0xe611, 0xe611, 0xe611, 0xe612, 0xe611, 0xe611, 0xe612, 0xe612, 0xe612, 0xee52, 0xee52, 0xee12, 0xee52, 0xee52, 0xee12, 0xee12, 0xee52, 0xee12, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xe5d0, 0xee10, 0xe610, 0xee53, 0xee52, 0xee52, 0xee53, 0xee53, 0xee53, 0xee53, 0xee52, 0xee52, 0xee52, 0xee52, 0xee12, 0xee12, 0xee12, 0xee12, 0xee52, 0xee11, 0xe5d0, 0xee52, 0xee52, 0xee52, 0xee11, 0xee12, 0xee12, 0xee52, 0xee52, 0xee52, 0xee52, 0xee52, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee52, 0xee12, 0xee12, 0xee12, 0xee52, 0xee52, 0xee52, 0xee12, 0xee11, 0xee12, 0xee12, 0xe611, 0xe611, 0xee11, 0xe611, 0xee11, 0xee52, 0xee12, 0xee52, 0xee52, 0xee52},
-  {0xddd1, 0xe611, 0xe612, 0xe612, 0xee53, 0xee53, 0xee53, 0xee12, 0xe612, 0xe612, 0xe612, 0xe612, 0xe612, 0xe611, 0xe612, 0xe612, 0xe612, 0xee52, 0xee52, 0xee52, 0xee52, 0xee52, 0xee52, 0xee12, 0xee11, 0xee12, 0xee12, 0xee11, 0xee11, 0xe611, 0xee52, 0xee52, 0xee12, 0xe611, 0xe611, 0xe612, 0xee12, 0xe612, 0xee52, 0xee52, 0xee12, 0xee12, 0xee52, 0xe612, 0xe612, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xe612, 0xee12, 0xee12, 0xee11, 0xee11, 0xee11, 0xe611, 0xee11, 0xee12, 0xee12, 0xee12, 0xee52, 0xee53, 0xee53, 0xee53, 0xe611, 0xe5d1, 0xe5d1, 0xee53, 0xee52, 0xee52, 0xee52, 0xee53, 0xee52, 0xee52, 0xee12, 0xee12, 0xee12, 0xee52, 0xee11, 0xee11, 0xee11, 0xee52, 0xee11, 0xee11, 0xee11, 0xee52, 0xee52, 0xee52, 0xee51, 0xee52, 0xee52, 0xee11, 0xee11, 0xee11, 0xee11, 0xee52, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xe611, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee52, 0xee52, 0xee52, 0xee52, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee11, 0xee12, 0xee12},
-  {0xe612, 0xee12, 0xe612, 0xee12, 0xe611, 0xe611, 0xee52, 0xee12, 0xee52, 0xee12, 0xee12, 0xee52, 0xee52, 0xee52, 0xee52, 0xee52, 0xee52, 0xe613, 0xee12, 0xee12, 0xee52, 0xee12, 0xe612, 0xe612, 0xe612, 0xee12, 0xee12, 0xee11, 0xee11, 0xe611, 0xe611, 0xe611, 0xe611, 0xe611, 0xe611, 0xe612, 0xee53, 0xee12, 0xe612, 0xe611, 0xee12, 0xee12, 0xee12, 0xe611, 0xe612, 0xee12, 0xe612, 0xe612, 0xee12, 0xee12, 0xe611, 0xe611, 0xee11, 0xe612, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee11, 0xee12, 0xee12, 0xee11, 0xee11, 0xee12, 0xee52, 0xee52, 0xee52, 0xe611, 0xee12, 0xee53, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee52, 0xee12, 0xee12, 0xee52, 0xee52, 0xee12, 0xee12, 0xee11, 0xee11, 0xe5d0, 0xee10, 0xee11, 0xee11, 0xe611, 0xe610, 0xee11, 0xee12, 0xee52, 0xee12, 0xee11, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee52, 0xee12, 0xee12, 0xe611, 0xe611, 0xee12, 0xee11, 0xee12, 0xee12, 0xee52, 0xee52, 0xee12, 0xee12, 0xee52},
-  {0xe611, 0xee11, 0xe611, 0xe611, 0xe611, 0xee12, 0xe612, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee53, 0xee52, 0xee12, 0xee12, 0xee52, 0xee12, 0xe612, 0xe612, 0xee12, 0xee52, 0xe612, 0xee52, 0xe612, 0xe612, 0xe611, 0xe611, 0xee12, 0xee12, 0xee12, 0xee12, 0xee13, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee11, 0xee11, 0xee11, 0xee11, 0xee12, 0xee52, 0xee52, 0xee52, 0xe612, 0xe612, 0xee52, 0xee52, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee52, 0xee12, 0xee12, 0xee12, 0xee11, 0xee11, 0xee11, 0xee11, 0xee12, 0xee52, 0xee12, 0xee12, 0xee52, 0xe611, 0xee12, 0xee52, 0xee53, 0xee53, 0xee53, 0xee53, 0xee52, 0xee52, 0xee12, 0xee52, 0xee12, 0xee52, 0xee52, 0xee52, 0xee52, 0xee12, 0xee12, 0xee12, 0xee11, 0xee12, 0xee52, 0xee52, 0xee12, 0xee12, 0xee11, 0xee11, 0xe5d1, 0xe611, 0xe611, 0xe611, 0xe612, 0xe612, 0xee12, 0xee12, 0xee52, 0xee52, 0xee52, 0xee52, 0xee12, 0xee12, 0xee12, 0xee52, 0xee52, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee11, 0xe611, 0xee52, 0xee52},
-  {0xd590, 0xddd0, 0xddd0, 0xdd90, 0xddd1, 0xddd1, 0xddd0, 0xddd1, 0xddd1, 0xddd1, 0xddd1, 0xddd1, 0xddd1, 0xddd1, 0xddd0, 0xddd0, 0xddd0, 0xdd90, 0xdd90, 0xdd90, 0xdd90, 0xdd90, 0xddd0, 0xddd1, 0xddd1, 0xddd1, 0xddd0, 0xdd90, 0xddd0, 0xd590, 0xdd90, 0xd54f, 0xdd8f, 0xdd90, 0xddd1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe611, 0xe5d1, 0xe611, 0xe5d1, 0xddd1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe611, 0xe5d1, 0xe5d1, 0xddd1, 0xddd0, 0xddd0, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xddd1, 0xddd1, 0xddd1, 0xe5d1, 0xe5d1, 0xddd1, 0xddd0, 0xddd0, 0xddd0, 0xddd0, 0xddd0, 0xe5d1, 0xdd90, 0xdd90, 0xddd1, 0xddd1, 0xddd0, 0xddd1, 0xddd1, 0xddd1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xddd1, 0xddd0, 0xe5d0, 0xdd90, 0xddd0, 0xddd0, 0xddd0, 0xddd1, 0xddd1, 0xddd1, 0xddd1, 0xddd0, 0xddd0, 0xdd90, 0xd58f, 0xdd90, 0xddd0, 0xddd1, 0xddd1, 0xddd1, 0xddd1, 0xddd1, 0xddd0, 0xddd0, 0xddd0, 0xddd1, 0xddd1, 0xddd1, 0xddd1, 0xddd1, 0xddd1, 0xddd1, 0xddd1, 0xddd1, 0xddd1, 0xddd1, 0xddd1, 0xddd1, 0xddd1, 0xddd1, 0xddd1, 0xddd1, 0xddd1, 0xddd1, 0xddd1},
-  {0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5d0, 0xe5cf, 0xe5d0, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe58e, 0xe58e, 0xe58e, 0xe5ce, 0xe5ce, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xdd90, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe590, 0xe590, 0xe590, 0xe5d0, 0xee11, 0xedd1, 0xe5d1, 0xe5d1, 0xe5d0, 0xe5d0, 0xe5d1, 0xe5d1, 0xe5d1, 0xee11, 0xedd0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe58f, 0xe590, 0xe590, 0xe590, 0xe58f, 0xe58f, 0xe590, 0xe590, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xdd8f, 0xe58f, 0xdd8f, 0xdd8f, 0xe58f, 0xdd8f, 0xdd4f, 0xdd8f, 0xe58f, 0xd54e, 0xe58e, 0xdd4d, 0xe58d, 0xe58d, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58d, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xdd8d, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe5ce, 0xe5ce, 0xe5ce, 0xe5ce, 0xe5ce, 0xe5ce, 0xe5ce, 0xe5ce, 0xe5ce, 0xe5ce, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5ce, 0xe5ce, 0xe5cf},
-  {0xe58e, 0xe58e, 0xe5ce, 0xe5ce, 0xe58e, 0xe5cf, 0xe5ce, 0xe5cf, 0xe58f, 0xe58f, 0xe58f, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe5ce, 0xe5cf, 0xe5cf, 0xe5cf, 0xe58f, 0xe58e, 0xe58f, 0xe58f, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xdd8f, 0xdd8f, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xedd0, 0xe58f, 0xe5d0, 0xe5d1, 0xe5d1, 0xe611, 0xee11, 0xee11, 0xe611, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d0, 0xe5d1, 0xedd1, 0xe5d1, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe590, 0xdd8f, 0xe5d0, 0xe5d1, 0xe5d1, 0xe5d1, 0xe611, 0xe5d1, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xdd8e, 0xe58f, 0xe58f, 0xe58f, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58f, 0xe5cf, 0xe5cf, 0xe58f, 0xe5cf, 0xe5cf, 0xe58f, 0xe58f, 0xe58e, 0xe58f, 0xe58f, 0xe58e, 0xe58f, 0xe58f, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe58f, 0xe58e, 0xe5cf, 0xe58e, 0xe5cf, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e},
-  {0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe5cf, 0xe5cf, 0xe58f, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xdd8e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xdd8e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58d, 0xe58d, 0xdd8d, 0xdd4f, 0xe590, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xedd0, 0xe58f, 0xd50e, 0xdd4f, 0xe590, 0xe5d1, 0xe5d1, 0xe5d1, 0xe590, 0xdd90, 0xe5d1, 0xee11, 0xe611, 0xee11, 0xee11, 0xee11, 0xe611, 0xee11, 0xe5d1, 0xe5d1, 0xedd1, 0xe5d1, 0xee11, 0xee11, 0xee11, 0xee11, 0xee11, 0xe5d1, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5cf, 0xe5cf, 0xe5d0, 0xe5d1, 0xe5d1, 0xe5d1, 0xee11, 0xe5d1, 0xe5d0, 0xe5d1, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d1, 0xe5d1, 0xe5d1, 0xdd4e, 0xe58f, 0xdd8f, 0xdd8f, 0xe5cf, 0xe5cf, 0xe5cf, 0xdd8e, 0xdd8e, 0xe58e, 0xe58e, 0xdd8e, 0xe58e, 0xe58f, 0xe58f, 0xe58f, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe58f, 0xe5cf, 0xe58f, 0xe58f, 0xe58f},
-  {0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58d, 0xdd8d, 0xe58e, 0xdd8d, 0xdd8d, 0xdd8d, 0xdd8d, 0xdd8d, 0xdd8d, 0xdd8d, 0xdd8d, 0xdd8d, 0xe58e, 0xe58e, 0xdd8e, 0xe58e, 0xe58e, 0xe58e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8d, 0xe58d, 0xdd8d, 0xdd4c, 0xdd8d, 0xdd8f, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xee11, 0xedd1, 0xe5d0, 0xe5d0, 0xe5d0, 0xedd0, 0xe5d0, 0xe590, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d1, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xedd0, 0xedd0, 0xedd0, 0xedd0, 0xe5d0, 0xe5cf, 0xe5cf, 0xe58f, 0xe58f, 0xe5d0, 0xe5d0, 0xe590, 0xe5d0, 0xe5d0, 0xedd1, 0xe5d1, 0xe5d1, 0xe5d1, 0xedd1, 0xe5d1, 0xe5d1, 0xe5d1, 0xdd8f, 0xe58f, 0xe58f, 0xe5cf, 0xe58f, 0xe5cf, 0xe5cf, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xdd8e, 0xe58e, 0xe58e, 0xe58f, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58e, 0xdd8e, 0xe58e, 0xe58f, 0xe58e, 0xe58e, 0xe58e, 0xdd8e, 0xdd8e, 0xdd8e, 0xe58e, 0xe58e, 0xe58e, 0xe58e},
-  {0xe58e, 0xe58e, 0xe58e, 0xdd8e, 0xe58e, 0xe58d, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xdd8d, 0xdd8d, 0xdd8d, 0xe58d, 0xe58e, 0xe58d, 0xe58d, 0xe58e, 0xe58e, 0xe590, 0xee11, 0xee11, 0xee11, 0xe5d1, 0xee11, 0xedd1, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d1, 0xedd1, 0xedd1, 0xee11, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xedd1, 0xedd1, 0xedd1, 0xedd1, 0xe5d0, 0xe5d0, 0xe5d0, 0xedd0, 0xe5d0, 0xe5d0, 0xe5d0, 0xedd0, 0xedcf, 0xe58f, 0xdd4d, 0xe58e, 0xe5cf, 0xe5cf, 0xe5d0, 0xedd0, 0xedd0, 0xe5d0, 0xe5d0, 0xee11, 0xe5d1, 0xedd1, 0xe5d0, 0xe5d0, 0xe5d0, 0xedd1, 0xdd8f, 0xdd8f, 0xdd8e, 0xdd8f, 0xe58f, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xe58f, 0xe58f, 0xdd8e, 0xdd4d, 0xdd8e, 0xdd8e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xdd8e, 0xdd8e, 0xdd8e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xdd8e, 0xe58e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xe58e, 0xe58e, 0xe58e, 0xdd8e, 0xdd8d, 0xe58e, 0xe58e, 0xe58e},
-  {0xe58e, 0xdd8e, 0xe58e, 0xdd8e, 0xe58e, 0xdd8d, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xdd8e, 0xdd8d, 0xe58e, 0xe5ce, 0xe5ce, 0xe58e, 0xe58e, 0xe58e, 0xdd4d, 0xe58d, 0xdd8d, 0xdd4d, 0xe58e, 0xdd4e, 0xdd90, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d1, 0xe5d1, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d1, 0xe5d1, 0xee11, 0xe5d1, 0xdd4f, 0xe590, 0xe590, 0xe590, 0xe5d0, 0xe590, 0xe590, 0xe590, 0xe590, 0xe5d1, 0xe5d1, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe590, 0xe5d0, 0xe58f, 0xdd4e, 0xd50d, 0xe54e, 0xe58e, 0xe58f, 0xe54e, 0xe54e, 0xe58f, 0xdd8f, 0xe590, 0xe5d0, 0xe5d0, 0xedd0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xdd8f, 0xdd4e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xe58f, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xe58f, 0xe58f, 0xdd8e, 0xdd8e, 0xdd8e, 0xe58e, 0xdd8e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xdd8d, 0xdd8e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xdd8e, 0xe58e, 0xdd8e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e},
-  {0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd4d, 0xdd8d, 0xdd8e, 0xdd8e, 0xdd8e, 0xe58e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd4e, 0xdd4d, 0xdd8e, 0xdd8e, 0xdd8e, 0xe58e, 0xe58e, 0xdd8d, 0xd50c, 0xd54e, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd4f, 0xdd8f, 0xdd90, 0xdd90, 0xdd90, 0xe5d0, 0xe5d0, 0xe5d0, 0xdd90, 0xdd90, 0xdd90, 0xdd90, 0xdd8f, 0xdd8f, 0xdd8f, 0xd50e, 0xd50d, 0xe590, 0xdd90, 0xdd90, 0xdd90, 0xdd90, 0xdd90, 0xdd90, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xdd90, 0xdd4f, 0xdd4f, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe58f, 0xe590, 0xd54e, 0xdd4e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8e, 0xdd4e, 0xdd4e, 0xdd4e, 0xdd4e, 0xdd4e, 0xdd8e, 0xdd4e, 0xdd4e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8f, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd4e, 0xdd4e, 0xdd4e, 0xdd4d, 0xdd4e, 0xdd4e, 0xdd4e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e},
-  {0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd4d, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8f, 0xe612, 0xe612, 0xe612, 0xe611, 0xe5d1, 0xe5d1, 0xe5d1, 0xe611, 0xe611, 0xe611, 0xe612, 0xe612, 0xe611, 0xe611, 0xe611, 0xe611, 0xe612, 0xe5d1, 0xe5d1, 0xe611, 0xe611, 0xe5d1, 0xe611, 0xddd0, 0xe5d1, 0xe5d0, 0xddd0, 0xe611, 0xe611, 0xe612, 0xee13, 0xe612, 0xe612, 0xe612, 0xee12, 0xee12, 0xee12, 0xee12, 0xe612, 0xe612, 0xee12, 0xe612, 0xe612, 0xe612, 0xe612, 0xe611, 0xe612, 0xe611, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee11, 0xee11, 0xedd1, 0xee11, 0xee11, 0xee12, 0xee12, 0xee11, 0xee11, 0xee11, 0xee11, 0xee11, 0xee11, 0xedd1, 0xedd0, 0xedd0, 0xedd1, 0xee11, 0xee11, 0xedd1, 0xe5d1, 0xe5d1, 0xedd1, 0xee11, 0xee11, 0xedd1, 0xedd1, 0xedd1, 0xe5d1, 0xedd1, 0xedd0, 0xdd4f, 0xdd8e, 0xdd8e, 0xdd4e, 0xdd4e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8f, 0xdd8f, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd4e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd4d, 0xdd4d, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e},
-  {0xe58e, 0xe58e, 0xdd8e, 0xdd8e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xdd8e, 0xe58e, 0xe58e, 0xe58e, 0xdd8f, 0xee12, 0xee12, 0xe612, 0xe612, 0xee12, 0xee12, 0xee12, 0xe612, 0xee11, 0xee12, 0xe612, 0xee52, 0xee52, 0xee12, 0xee12, 0xee12, 0xee12, 0xe612, 0xe612, 0xee52, 0xee52, 0xee12, 0xee52, 0xe612, 0xe612, 0xe611, 0xee11, 0xee12, 0xee12, 0xe612, 0xee12, 0xe612, 0xe612, 0xe612, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee11, 0xe611, 0xee11, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xe612, 0xf653, 0xf653, 0xf653, 0xf653, 0xf653, 0xf653, 0xf653, 0xf653, 0xf653, 0xf653, 0xee53, 0xf653, 0xf653, 0xf653, 0xee12, 0xee12, 0xee12, 0xee52, 0xee52, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xf652, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee11, 0xee11, 0xee12, 0xee12, 0xee11, 0xe590, 0xdd4e, 0xdd8e, 0xe58f, 0xdd8e, 0xdd8f, 0xdd8f, 0xe5cf, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xdd4e, 0xdd4e, 0xe58e, 0xe58f, 0xe58f, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xdd8e, 0xdd8e, 0xdd8e, 0xe58e, 0xe58e, 0xe58e},
-  {0xdd8e, 0xdd8e, 0xe58e, 0xe58e, 0xe58e, 0xdd8e, 0xdd8e, 0xe58e, 0xdd8e, 0xdd8e, 0xdd8e, 0xe58e, 0xe58e, 0xe58e, 0xdd8f, 0xee53, 0xee53, 0xee52, 0xee12, 0xee12, 0xee12, 0xee52, 0xe612, 0xee52, 0xee52, 0xee52, 0xee53, 0xee52, 0xee52, 0xee52, 0xee52, 0xe612, 0xe612, 0xe612, 0xee12, 0xee12, 0xee11, 0xe611, 0xee11, 0xe612, 0xee11, 0xee11, 0xe611, 0xe612, 0xe612, 0xee52, 0xee12, 0xee12, 0xe612, 0xe612, 0xee12, 0xee12, 0xe611, 0xe611, 0xee12, 0xe612, 0xee12, 0xee12, 0xee12, 0xe611, 0xe611, 0xee12, 0xe5d1, 0xee12, 0xee53, 0xf653, 0xf654, 0xf654, 0xf654, 0xf654, 0xf654, 0xf654, 0xf654, 0xf695, 0xf694, 0xf694, 0xf694, 0xf694, 0xf654, 0xf654, 0xf654, 0xee54, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee54, 0xee53, 0xee53, 0xee53, 0xf653, 0xf653, 0xee53, 0xee53, 0xf654, 0xee53, 0xee54, 0xee54, 0xee53, 0xe612, 0xdd8f, 0xdd8f, 0xdd8f, 0xe58f, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd4e, 0xdd4d, 0xdd4d, 0xe58e, 0xdd8e, 0xdd8e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xdd8e, 0xdd8e, 0xdd8e, 0xe58e},
-  {0xe58e, 0xe58e, 0xdd8e, 0xe58f, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xdd8e, 0xe58e, 0xe58e, 0xe58e, 0xddd0, 0xee53, 0xee13, 0xee53, 0xee52, 0xe612, 0xe612, 0xee52, 0xee12, 0xe612, 0xe612, 0xe612, 0xe653, 0xee52, 0xee12, 0xee12, 0xee52, 0xee12, 0xee12, 0xee12, 0xee12, 0xe611, 0xee12, 0xe611, 0xe5d1, 0xee53, 0xee52, 0xee12, 0xe611, 0xe611, 0xe612, 0xee52, 0xe612, 0xe652, 0xe612, 0xee12, 0xe612, 0xee12, 0xee12, 0xee12, 0xee12, 0xee11, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xe613, 0xf695, 0xf654, 0xf695, 0xf695, 0xf695, 0xf695, 0xf694, 0xf654, 0xf694, 0xee54, 0xee54, 0xee54, 0xf694, 0xf694, 0xf694, 0xee54, 0xf694, 0xf654, 0xf654, 0xf654, 0xf694, 0xf654, 0xf654, 0xee54, 0xf654, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xf653, 0xf653, 0xf653, 0xf653, 0xe612, 0xe5cf, 0xe58f, 0xe58f, 0xe5cf, 0xe5cf, 0xe58f, 0xe5cf, 0xdd8e, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xdd8e, 0xe58e, 0xdd8e, 0xdd8e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58f, 0xe58e},
-  {0xe5cf, 0xe5cf, 0xe5cf, 0xe58f, 0xe5cf, 0xe5cf, 0xe5cf, 0xe58f, 0xe58f, 0xe58f, 0xdd8e, 0xe58f, 0xe58e, 0xe58f, 0xdd90, 0xee53, 0xee13, 0xee12, 0xee12, 0xee12, 0xee12, 0xe612, 0xe611, 0xe611, 0xe611, 0xe5d1, 0xe612, 0xe612, 0xe611, 0xe612, 0xe611, 0xe611, 0xee11, 0xe611, 0xee12, 0xee12, 0xe611, 0xe611, 0xee11, 0xee52, 0xee52, 0xee12, 0xee11, 0xee11, 0xe611, 0xe611, 0xe611, 0xe611, 0xe612, 0xe611, 0xe611, 0xe611, 0xe611, 0xe611, 0xe611, 0xe611, 0xee11, 0xee12, 0xe612, 0xe612, 0xee12, 0xe612, 0xe612, 0xf694, 0xf695, 0xf695, 0xf694, 0xf695, 0xf695, 0xf694, 0xf694, 0xf654, 0xee13, 0xee53, 0xf654, 0xf694, 0xf694, 0xf694, 0xf695, 0xf654, 0xee54, 0xf654, 0xf695, 0xf695, 0xf694, 0xf694, 0xf654, 0xee12, 0xee53, 0xee53, 0xf654, 0xf654, 0xf694, 0xf654, 0xf653, 0xee11, 0xee53, 0xf653, 0xee53, 0xee12, 0xe5d1, 0xe58f, 0xdd8f, 0xe58f, 0xe58f, 0xe5cf, 0xe58f, 0xe5cf, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xe58f, 0xe58e, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe58f, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe58f},
-  {0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe58f, 0xe5ce, 0xe5cf, 0xe5cf, 0xe58f, 0xe5cf, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xddd0, 0xee13, 0xee12, 0xee12, 0xe611, 0xee12, 0xee53, 0xe612, 0xee52, 0xe611, 0xee12, 0xe611, 0xee12, 0xe611, 0xee12, 0xe611, 0xe611, 0xee12, 0xee11, 0xe611, 0xe611, 0xe611, 0xe611, 0xddd0, 0xe5d0, 0xddcf, 0xdd8f, 0xdd8f, 0xe5d0, 0xe611, 0xe611, 0xee12, 0xee11, 0xe611, 0xee12, 0xe611, 0xe611, 0xe611, 0xee12, 0xee12, 0xe611, 0xe611, 0xe611, 0xe611, 0xe611, 0xe612, 0xee12, 0xee12, 0xe612, 0xf654, 0xee53, 0xee53, 0xf653, 0xf654, 0xf654, 0xf654, 0xf695, 0xf695, 0xf695, 0xee53, 0xee53, 0xee53, 0xee53, 0xf654, 0xee53, 0xf654, 0xf654, 0xf654, 0xf654, 0xf694, 0xee54, 0xee53, 0xf654, 0xee11, 0xe5d1, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee52, 0xf653, 0xee53, 0xf653, 0xf653, 0xf653, 0xe611, 0xdd8f, 0xe58f, 0xe58f, 0xe5cf, 0xe58f, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe58f, 0xe58f, 0xe5cf, 0xe5cf, 0xe58f, 0xe58f, 0xe5cf},
-  {0xe58e, 0xe58e, 0xe58e, 0xe5ce, 0xe5ce, 0xe5ce, 0xe5ce, 0xe5ce, 0xe5ce, 0xe5cf, 0xe5cf, 0xe5ce, 0xe58e, 0xe58e, 0xdd8f, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe611, 0xe611, 0xee11, 0xe5d1, 0xee11, 0xedd1, 0xedd1, 0xe5d1, 0xee12, 0xee12, 0xee11, 0xe5d1, 0xe5d1, 0xe5d1, 0xee11, 0xee11, 0xee11, 0xee11, 0xe5d1, 0xee11, 0xee11, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d0, 0xe5d0, 0xdd90, 0xdd8f, 0xe58f, 0xe5d0, 0xe590, 0xe5d0, 0xedd1, 0xe5d1, 0xe611, 0xe5d1, 0xe611, 0xe5d1, 0xe5d1, 0xe612, 0xee54, 0xf654, 0xf654, 0xf654, 0xf654, 0xf654, 0xf653, 0xee53, 0xee54, 0xf654, 0xee54, 0xf653, 0xee54, 0xf694, 0xf694, 0xf654, 0xee54, 0xee54, 0xf654, 0xee54, 0xee94, 0xf694, 0xf694, 0xf654, 0xee12, 0xee53, 0xee53, 0xf654, 0xf654, 0xf694, 0xf654, 0xee53, 0xee53, 0xee53, 0xf653, 0xf653, 0xf653, 0xe612, 0xe58e, 0xe58e, 0xdd8e, 0xe58e, 0xe58d, 0xe58d, 0xdd8e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xdd8e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e},
-  {0xddd0, 0xdd90, 0xddd0, 0xddd0, 0xe5d0, 0xe5d1, 0xddd0, 0xddd0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xddd0, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe611, 0xe612, 0xe611, 0xe5d1, 0xe5d0, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d0, 0xe5d1, 0xe5d1, 0xe5d0, 0xdd90, 0xddd0, 0xddd1, 0xdd90, 0xdd90, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd90, 0xdd90, 0xdd90, 0xdd8f, 0xdd90, 0xdd8f, 0xdd8f, 0xdd4e, 0xdd4f, 0xdd4f, 0xdd4f, 0xdd4f, 0xdd8f, 0xdd90, 0xe5d2, 0xe612, 0xe613, 0xe612, 0xe612, 0xe612, 0xddd2, 0xddd1, 0xddd1, 0xddd1, 0xddd1, 0xddd1, 0xddd2, 0xe5d2, 0xddd1, 0xddd1, 0xddd1, 0xddd1, 0xddd1, 0xe5d2, 0xe5d2, 0xe5d2, 0xe5d2, 0xddd1, 0xddd1, 0xddd1, 0xddd1, 0xddd1, 0xddd1, 0xddd1, 0xddd1, 0xddd1, 0xddd1, 0xddd1, 0xddd1, 0xddd1, 0xddd1, 0xd590, 0xd58e, 0xd54e, 0xd54e, 0xe5d0, 0xe5d0, 0xdd8f, 0xdd8f, 0xdd8f, 0xddcf, 0xdd8f, 0xddd0, 0xe5d0, 0xddd0, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f},
-  {0xe5d1, 0xe611, 0xee12, 0xee12, 0xee53, 0xee53, 0xee52, 0xee12, 0xee12, 0xee12, 0xee52, 0xee12, 0xee11, 0xee12, 0xee12, 0xee12, 0xee52, 0xee52, 0xee52, 0xee12, 0xee11, 0xee12, 0xee12, 0xee52, 0xee52, 0xee12, 0xee12, 0xee12, 0xee53, 0xee53, 0xe612, 0xee52, 0xee52, 0xee53, 0xee53, 0xee11, 0xee12, 0xee11, 0xe5d1, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe58e, 0xe58e, 0xe58e, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5ce, 0xe5ce, 0xe58e, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xdd8d, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xdd4e, 0xee52, 0xee12, 0xe611, 0xe5d0, 0xe5d0, 0xe611, 0xe5d0, 0xee11, 0xe612, 0xe612, 0xee12, 0xee52, 0xee52, 0xee12, 0xee52, 0xee12, 0xee12, 0xee52, 0xee52, 0xee12, 0xe612, 0xee12, 0xe611, 0xe611},
-  {0xee11, 0xee11, 0xee11, 0xe611, 0xee12, 0xee52, 0xee52, 0xee12, 0xee12, 0xee11, 0xee52, 0xee52, 0xee52, 0xee52, 0xee52, 0xee52, 0xee52, 0xee12, 0xee11, 0xe611, 0xee12, 0xee12, 0xee11, 0xee11, 0xee11, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee52, 0xee52, 0xee53, 0xee53, 0xee52, 0xe611, 0xee12, 0xe5d0, 0xdd8d, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe5cf, 0xe5cf, 0xe5cf, 0xe58f, 0xe5cf, 0xe58e, 0xe5ce, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58f, 0xe58f, 0xe58f, 0xe5cf, 0xe58f, 0xe5cf, 0xe58e, 0xe58f, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe58e, 0xe58e, 0xe5cf, 0xe58e, 0xe58e, 0xe58f, 0xe58f, 0xe5cf, 0xe5cf, 0xdd8f, 0xee52, 0xee11, 0xe611, 0xee10, 0xee11, 0xe611, 0xee11, 0xee11, 0xee53, 0xee53, 0xee53, 0xee52, 0xee12, 0xee52, 0xee52, 0xee12, 0xe611, 0xee12, 0xee12, 0xee12, 0xee11, 0xee11, 0xee12, 0xee12},
-  {0xee52, 0xee52, 0xee12, 0xee12, 0xee12, 0xee52, 0xee12, 0xee12, 0xee52, 0xee12, 0xee52, 0xee12, 0xee12, 0xee52, 0xee12, 0xee12, 0xee12, 0xee12, 0xee52, 0xee52, 0xee12, 0xee11, 0xee11, 0xee12, 0xee12, 0xee12, 0xee11, 0xe611, 0xe611, 0xee11, 0xee12, 0xee12, 0xee52, 0xee53, 0xee52, 0xee53, 0xee52, 0xee52, 0xe5d1, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xdd8e, 0xdd8e, 0xdd8d, 0xdd8d, 0xdd8d, 0xe58d, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xe58e, 0xdd8e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58e, 0xe5cf, 0xe5cf, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xdd8f, 0xee53, 0xe590, 0xe5d0, 0xe5d0, 0xee52, 0xee52, 0xee11, 0xee52, 0xee53, 0xee53, 0xee53, 0xee52, 0xee52, 0xee52, 0xee52, 0xee12, 0xee12, 0xee12, 0xee12, 0xee52, 0xee11, 0xee11, 0xee52, 0xee52},
-  {0xee52, 0xee12, 0xee12, 0xee52, 0xee52, 0xee12, 0xee12, 0xee12, 0xee52, 0xee12, 0xee11, 0xee11, 0xee11, 0xee11, 0xe5d0, 0xee11, 0xee11, 0xee12, 0xee12, 0xee12, 0xee12, 0xee52, 0xee12, 0xee52, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee11, 0xee11, 0xee11, 0xee12, 0xee11, 0xee12, 0xee12, 0xee52, 0xee52, 0xe5d1, 0xe58e, 0xe58d, 0xe58e, 0xe58d, 0xdd8d, 0xdd4d, 0xdd4d, 0xdd8d, 0xdd8d, 0xdd4d, 0xe54d, 0xe58d, 0xe58d, 0xdd8d, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58d, 0xe58d, 0xe58d, 0xe58d, 0xe58d, 0xe58e, 0xe58d, 0xdd8d, 0xdd8d, 0xdd8e, 0xdd8e, 0xe58e, 0xdd8e, 0xe58e, 0xe58e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xdd8e, 0xdd8e, 0xe58e, 0xe58e, 0xe58e, 0xdd8e, 0xdd8f, 0xdd8e, 0xdd8e, 0xe58e, 0xe58e, 0xe58e, 0xe58f, 0xe58f, 0xe58f, 0xe58e, 0xe58e, 0xe58e, 0xe58f, 0xe58e, 0xe58f, 0xdd8f, 0xee53, 0xee12, 0xe5d1, 0xe58f, 0xee52, 0xee53, 0xee52, 0xee52, 0xee53, 0xee53, 0xee53, 0xee52, 0xee52, 0xee12, 0xee52, 0xee52, 0xee11, 0xee12, 0xee52, 0xee52, 0xee11, 0xe58f, 0xee12, 0xee52},
-  {0xee51, 0xee11, 0xee11, 0xee11, 0xee11, 0xee11, 0xee11, 0xee11, 0xee12, 0xee12, 0xee12, 0xee52, 0xee52, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee52, 0xee52, 0xee12, 0xe611, 0xee12, 0xee52, 0xee52, 0xee52, 0xee52, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee11, 0xe5d0, 0xcc8a, 0xdd0b, 0xdd4d, 0xe58d, 0xe58d, 0xe58e, 0xe58d, 0xe58e, 0xe58e, 0xe58e, 0xe58d, 0xe58e, 0xe58e, 0xe58d, 0xdd8d, 0xdd8d, 0xdd8e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xdd8e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xdd4e, 0xdd8e, 0xe58e, 0xe58e, 0xe58e, 0xdd8e, 0xdd8e, 0xdd8e, 0xe58e, 0xe58e, 0xdd8e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xdd8e, 0xdd8e, 0xdd8e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xdd8e, 0xee53, 0xee11, 0xee12, 0xee52, 0xee52, 0xee12, 0xee52, 0xee52, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee52, 0xee12, 0xee11, 0xee11, 0xee11, 0xee11, 0xee10, 0xee10, 0xee11, 0xee51},
-  {0xee11, 0xe611, 0xee11, 0xe611, 0xee52, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xe612, 0xee12, 0xee11, 0xee12, 0xee12, 0xee12, 0xee52, 0xee12, 0xee52, 0xee12, 0xee12, 0xee12, 0xee52, 0xee52, 0xe611, 0xee12, 0xee12, 0xe5d1, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee52, 0xe5d1, 0xe50c, 0xdcca, 0xe54c, 0xe54c, 0xe58d, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xdd4d, 0xe58d, 0xe58d, 0xdd4d, 0xe58e, 0xe58e, 0xe58e, 0xe5ce, 0xe5ce, 0xe58e, 0xdd8d, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xdd8d, 0xe58e, 0xe58e, 0xe58e, 0xdd8e, 0xe58e, 0xdd8e, 0xdd8e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xdd8e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xdd8e, 0xdd8e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xdd4e, 0xee12, 0xe611, 0xee11, 0xee52, 0xee52, 0xee11, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee53, 0xee53, 0xee52, 0xee12, 0xee52, 0xee12, 0xee12, 0xee11, 0xee11, 0xee11, 0xee10, 0xee11, 0xee11},
-  {0xe612, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xe611, 0xe611, 0xe611, 0xe611, 0xe5d1, 0xe5d1, 0xe611, 0xe612, 0xe612, 0xe612, 0xe612, 0xe652, 0xee52, 0xe612, 0xee52, 0xe612, 0xe612, 0xee12, 0xee12, 0xee52, 0xee12, 0xee12, 0xee52, 0xee52, 0xee52, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee52, 0xee12, 0xddd1, 0xdd4e, 0xe54d, 0xd50c, 0xdd0c, 0xdd4d, 0xe58e, 0xdd8e, 0xe58e, 0xd50c, 0xe58e, 0xdd8e, 0xe5ce, 0xe58e, 0xdd8e, 0xdd8e, 0xdd4e, 0xdd8e, 0xdd8e, 0xdd8e, 0xe58e, 0xe58f, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8d, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd4e, 0xdd8e, 0xdd4e, 0xdd4e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8f, 0xe58f, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd4e, 0xdd8e, 0xd54e, 0xe611, 0xe611, 0xe611, 0xe611, 0xe612, 0xee12, 0xee11, 0xe611, 0xee12, 0xee12, 0xee13, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee12, 0xe612, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xe612},
-  {0xdd4e, 0xdd4e, 0xdd4e, 0xdd4e, 0xdd4e, 0xdd4e, 0xdd4e, 0xdd4e, 0xdd4e, 0xdd4e, 0xdd4e, 0xd54d, 0xdd4e, 0xdd4e, 0xdd8e, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd90, 0xddd0, 0xddd0, 0xe5d0, 0xe5d0, 0xe5d0, 0xddd0, 0xdd90, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xddd1, 0xe613, 0xe612, 0xe612, 0xe612, 0xe612, 0xe612, 0xe613, 0xe613, 0xe613, 0xe612, 0xe613, 0xe613, 0xe613, 0xe613, 0xe612, 0xe612, 0xe611, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe590, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xd54e, 0xd54e, 0xd54e, 0xd50d, 0xd54e, 0xd54e, 0xd54e, 0xd54e, 0xdd4e, 0xdd4e, 0xdd4e, 0xdd4e, 0xdd4e, 0xdd4e, 0xdd4e, 0xdd4e, 0xdd4e},
-  {0xdd4e, 0xdd4e, 0xdd4e, 0xdd4d, 0xdd4e, 0xdd4e, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4c, 0xdd4d, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xdd8e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xdd8e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58f, 0xe58e, 0xe5cf, 0xe5cf, 0xe5cf, 0xe58e, 0xe5ce, 0xe58f, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe58e, 0xe5ce, 0xe5ce, 0xe5cf, 0xe58f, 0xe5cf, 0xe58e, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5ce, 0xe5ce, 0xe5ce, 0xe58e, 0xe58e, 0xe58e, 0xe58f, 0xe5cf, 0xe5cf, 0xddd0, 0xee12, 0xee11, 0xee11, 0xee12, 0xee11, 0xee11, 0xee11, 0xee11, 0xee11, 0xedd1, 0xee11, 0xee11, 0xe5d1, 0xe5d1, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe58f, 0xe58f, 0xe5cf, 0xe58f, 0xe58f, 0xe58e, 0xe58e, 0xdd8e, 0xdd4d, 0xdd4e, 0xdd4e, 0xdd4e, 0xdd4d, 0xdd4d, 0xdd4e, 0xdd4d, 0xdd4d, 0xdd4d, 0xd54d, 0xd50d, 0xd50d, 0xd54d, 0xdd4e, 0xdd8e, 0xdd4e, 0xdd4e, 0xdd4e, 0xdd4e, 0xdd4e, 0xdd4e, 0xdd4e, 0xdd8e},
-  {0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd8d, 0xdd8d, 0xe58e, 0xdd8e, 0xdd4e, 0xe58f, 0xdd8e, 0xe58f, 0xe5cf, 0xe58f, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58f, 0xe58f, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe58f, 0xe5cf, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe5cf, 0xe58e, 0xe5ce, 0xe5cf, 0xe58f, 0xe5cf, 0xe5ce, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xdd8e, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe5cf, 0xe5cf, 0xe58f, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5d0, 0xe5d0, 0xe5cf, 0xe58f, 0xe5d0, 0xe5cf, 0xe5cf, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58e, 0xe58f, 0xe58f, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xe58e, 0xdd8e, 0xdd4e, 0xdd4e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xe58e, 0xe58e, 0xdd8e, 0xdd4e, 0xdd4e, 0xdd4d, 0xdd4d},
-  {0xdd4d, 0xdd4c, 0xdd8d, 0xdd4d, 0xdd8d, 0xdd4d, 0xe58d, 0xdd8d, 0xdd8d, 0xdd4d, 0xd54c, 0xd54d, 0xe58f, 0xe58f, 0xe58f, 0xe5cf, 0xe5cf, 0xe5cf, 0xe58f, 0xdd8e, 0xe58f, 0xdd8f, 0xdd8f, 0xe58e, 0xdd8e, 0xe58f, 0xdd8f, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe58f, 0xe58f, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe58f, 0xe58f, 0xe58f, 0xe5cf, 0xe58f, 0xe5cf, 0xe58f, 0xe58f, 0xdd8e, 0xdd8e, 0xe58f, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58d, 0xe58d, 0xe58e, 0xe58e, 0xe58e, 0xdd4e, 0xdd8e, 0xe58e, 0xdd4d, 0xdd4d, 0xdd4e, 0xe58e, 0xe58e, 0xdd8e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xdd4d, 0xdd8e, 0xdd4e, 0xdd4e, 0xdd4e, 0xdd4e, 0xdd4e, 0xe58e, 0xe58f, 0xe58f, 0xe58f, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd4e, 0xdd4e, 0xdd4e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd4e, 0xdd4d, 0xd50d, 0xd50d, 0xd50c, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4e, 0xdd4d},
-  {0xdd8e, 0xdd4d, 0xdd4d, 0xe58e, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd8d, 0xe58d, 0xdd4d, 0xdd4c, 0xdd4e, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58e, 0xdd8e, 0xe58e, 0xdd8e, 0xe58e, 0xe58e, 0xdd8e, 0xe58e, 0xdd8e, 0xe58e, 0xdd8e, 0xe58f, 0xdd8e, 0xe58f, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58f, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xdd8e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xdd8d, 0xe58d, 0xe58d, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xdd8e, 0xe58e, 0xe58e, 0xe58e, 0xdd8e, 0xe58f, 0xe58f, 0xdd8e, 0xdd8e, 0xdd4e, 0xe58e, 0xe58e, 0xe58f, 0xe58f, 0xdd4e, 0xdd4e, 0xe58e, 0xdd4e, 0xdd8e, 0xdd4e, 0xdd4e, 0xdd4d, 0xdd8e, 0xdd8e, 0xdd4e, 0xdd4d, 0xdd4e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xe58e, 0xe58e, 0xe58e, 0xdd8e, 0xdd8e, 0xe58f, 0xdd8e, 0xe58e, 0xdd8e, 0xdd8e, 0xe58e, 0xdd4e, 0xdd8e, 0xdd4e, 0xe58e, 0xe58e, 0xdd8e, 0xdd8e, 0xe58e, 0xdd8e, 0xe58e, 0xe58e, 0xdd8e, 0xdd8e, 0xe58e},
-  {0xdd8e, 0xdd8e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xdd8d, 0xdd4d, 0xdd4d, 0xe58d, 0xdd4d, 0xdd4e, 0xdd8f, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd4e, 0xdd4d, 0xdd4d, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xdd8e, 0xdd8e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xe58e, 0xdd8e, 0xe58e, 0xe58e, 0xdd8e, 0xdd8e, 0xdd8e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xdd8d, 0xe58d, 0xe58e, 0xdd8d, 0xdd8d, 0xdd8d, 0xdd8d, 0xdd8d, 0xdd8e, 0xdd8e, 0xe58d, 0xe58e, 0xe58e, 0xdd8e, 0xe58e, 0xe58e, 0xdd4e, 0xe58f, 0xe58f, 0xe590, 0xe5d0, 0xe58f, 0xe58f, 0xe58e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xe58e, 0xdd8e, 0xdd8e, 0xe58e, 0xdd8e, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xdd8e, 0xdd4e, 0xdd4e, 0xdd4e, 0xe58e, 0xe58f, 0xdd4e, 0xdd4d, 0xdd4e, 0xdd4e, 0xdd8e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xdd8e, 0xdd4e, 0xdd4e, 0xdd8e, 0xdd4e, 0xdd8e, 0xdd8e, 0xdd8e, 0xe58e, 0xdd8e, 0xdd8e, 0xe58e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e},
-  {0xe58f, 0xe58f, 0xe58e, 0xdd8e, 0xe58e, 0xe58e, 0xe58e, 0xdd8e, 0xdd8d, 0xdd4d, 0xdd4d, 0xd54d, 0xdd4e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8f, 0xe58f, 0xe58f, 0xe58f, 0xdd8e, 0xe58f, 0xe58f, 0xe58f, 0xe58e, 0xdd8e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xdd8e, 0xdd8e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xdd8e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xdd4d, 0xdd8e, 0xdd4e, 0xdd4e, 0xdd4e, 0xdd4e, 0xdd4e, 0xe58e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xe58e, 0xdd8e, 0xe58e, 0xdd8e, 0xdd8e, 0xdd4e, 0xdd8f, 0xdd8f, 0xe58f, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd4e, 0xdd8e, 0xdd4e, 0xdd8e, 0xe58f, 0xdd4e, 0xdd8e, 0xdd8e, 0xe58f, 0xe58e, 0xdd4e, 0xe58f, 0xdd8f, 0xe58f, 0xe58f, 0xe58f, 0xdd8e, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58f},
-  {0xdd8f, 0xdd8f, 0xdd8f, 0xd58f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xd58f, 0xdd8f, 0xdd90, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd90, 0xdd90, 0xdd90, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xd54e, 0xdd8f, 0xdd8f, 0xdd8e, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xd54f, 0xdd8f, 0xdd8f, 0xd58f, 0xddd0, 0xdd90, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xddd0, 0xe5d0, 0xe5d0, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd90, 0xdd90, 0xdd90, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd90, 0xdd90, 0xdd90, 0xdd90, 0xdd90, 0xdd90, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd90, 0xdd90, 0xdd90, 0xdd90, 0xdd90, 0xdd90, 0xdd90, 0xdd90, 0xdd90, 0xdd90, 0xdd90, 0xdd90, 0xdd90, 0xdd90, 0xdd90, 0xdd90, 0xdd90, 0xdd90, 0xdd90, 0xdd90, 0xdd90, 0xd54f, 0xdd4f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xd58f},
-  {0xe5d0, 0xe5d0, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d1, 0xe5d1, 0xe611, 0xe5d1, 0xe5d1, 0xe5d1, 0xddd0, 0xe5d1, 0xe5d0, 0xddd0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xddd0, 0xe5d0, 0xe5d0, 0xddd0, 0xe5d0, 0xddd0, 0xe5d0, 0xe5d0, 0xe5d1, 0xe5d1, 0xe5d0, 0xe5d1, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xdd90, 0xee52, 0xee11, 0xedd0, 0xe5cf, 0xedcf, 0xedd0, 0xedcf, 0xe5cf, 0xe5cf, 0xe58f, 0xe5cf, 0xe5cf, 0xe58f, 0xe58f, 0xe58f, 0xe58e, 0xedcf, 0xe5cf, 0xe5d0, 0xedd0, 0xee10, 0xee11, 0xee11, 0xee11, 0xee10, 0xee10, 0xee11, 0xee11, 0xee11, 0xee11, 0xee11, 0xee11, 0xee11, 0xee11, 0xee11, 0xee10, 0xee10, 0xee11, 0xee11, 0xedd0, 0xee10, 0xee10, 0xee10, 0xee10, 0xedd0, 0xedd0, 0xedd0, 0xedd0, 0xee10, 0xedd0, 0xe5d0, 0xedd0, 0xedd0, 0xe5d0, 0xedd0, 0xee10, 0xee11, 0xee11, 0xee11, 0xee11, 0xee11, 0xee11, 0xee11, 0xee11, 0xedd1, 0xee11, 0xee11, 0xee11, 0xee11, 0xee11, 0xee11, 0xee11, 0xee11, 0xee11, 0xee11, 0xd54e, 0xdd90, 0xe5d1, 0xe611, 0xe611, 0xe5d1, 0xe5d1, 0xe5d0},
-  {0xe5d0, 0xdd8f, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe610, 0xe5d0, 0xe5d0, 0xe5d1, 0xe5d1, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5cf, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5cf, 0xe5cf, 0xe5d0, 0xe590, 0xe5d0, 0xe5d0, 0xdd90, 0xee11, 0xe5d0, 0xe5cf, 0xe58e, 0xe58e, 0xedcf, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe5cf, 0xedcf, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xed8f, 0xe5cf, 0xedcf, 0xe5d0, 0xe5d0, 0xedd0, 0xedd0, 0xedd0, 0xedcf, 0xedd0, 0xedd0, 0xedd0, 0xedd0, 0xedd0, 0xedd0, 0xedd0, 0xedd0, 0xedd0, 0xedd0, 0xedd0, 0xedd0, 0xedd0, 0xedd0, 0xedd0, 0xedd0, 0xedd0, 0xedd0, 0xedd0, 0xedd0, 0xedd0, 0xedd0, 0xedd0, 0xedd0, 0xedd0, 0xedd0, 0xedd0, 0xedd0, 0xedd0, 0xedd0, 0xedd0, 0xedd0, 0xedd0, 0xedd0, 0xedd0, 0xedd0, 0xedd0, 0xedd0, 0xedd0, 0xedd0, 0xedd0, 0xedd0, 0xedd0, 0xedd0, 0xedd0, 0xedd0, 0xedd0, 0xedd0, 0xe5d0, 0xd54e, 0xdd8f, 0xdd8f, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0},
-  {0xdd8f, 0xdd8e, 0xdd8e, 0xe58f, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xdd8f, 0xdd8e, 0xe5ce, 0xe5cf, 0xe5cf, 0xddcf, 0xe5d0, 0xe5d1, 0xe5d1, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xdd8f, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xdd8f, 0xe5d0, 0xe5cf, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58d, 0xe58d, 0xe58e, 0xe58e, 0xe58e, 0xe58f, 0xe58f, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58f, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xedcf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xedcf, 0xedcf, 0xedcf, 0xedcf, 0xe5cf, 0xe5cf, 0xedcf, 0xedcf, 0xedcf, 0xedcf, 0xe5cf, 0xe5cf, 0xedd0, 0xedd0, 0xedd0, 0xe5d0, 0xedd0, 0xedd0, 0xe5d0, 0xe5d0, 0xedd0, 0xe5cf, 0xe5cf, 0xedd0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xedd0, 0xedd0, 0xedd0, 0xedd0, 0xedd0, 0xe5d0, 0xedd0, 0xedd1, 0xedd1, 0xedd1, 0xedd0, 0xedd0, 0xedd1, 0xee11, 0xee11, 0xee11, 0xd54e, 0xe58f, 0xe5cf, 0xe5d0, 0xe5d0, 0xe5cf, 0xe58f, 0xe58f},
-  {0xdd4d, 0xd54d, 0xdd4e, 0xdd4d, 0xdd8e, 0xe58e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd4d, 0xd54d, 0xdd8e, 0xe5cf, 0xe5cf, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe610, 0xe5d0, 0xe5d0, 0xddd0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5cf, 0xe5cf, 0xe5d0, 0xe5cf, 0xe5d0, 0xe5d0, 0xe5d0, 0xdd8f, 0xe5d1, 0xe5cf, 0xe58e, 0xe54e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58f, 0xe58f, 0xe5cf, 0xe58f, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58f, 0xe5cf, 0xe5cf, 0xe58f, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xedd0, 0xedd0, 0xedd0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xedd1, 0xe5d0, 0xe5d0, 0xe5d0, 0xedd0, 0xedd0, 0xedd0, 0xe5d0, 0xe5d0, 0xedd1, 0xee11, 0xee11, 0xee11, 0xee11, 0xee11, 0xee11, 0xee11, 0xee11, 0xee11, 0xee11, 0xee11, 0xee11, 0xee11, 0xee12, 0xee12, 0xee12, 0xee12, 0xd50d, 0xdd4e, 0xdd8e, 0xe58e, 0xdd8e, 0xdd4d, 0xdd4d, 0xdd4d},
-  {0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd8e, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd8e, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe58f, 0xe58f, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5d0, 0xe5cf, 0xe58f, 0xe5cf, 0xe5cf, 0xe5d0, 0xddcf, 0xe5cf, 0xe5cf, 0xe58f, 0xe5cf, 0xe58f, 0xe58f, 0xe5cf, 0xe58f, 0xe5cf, 0xe58f, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xdd4e, 0xe5d0, 0xe58f, 0xe58f, 0xe58f, 0xe58e, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe5cf, 0xe5cf, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe5cf, 0xe58f, 0xe58f, 0xe58f, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5d0, 0xe5cf, 0xe5d0, 0xe5d0, 0xe5d0, 0xedd0, 0xe5d0, 0xedd0, 0xedd0, 0xedd0, 0xe5d0, 0xedd0, 0xedd0, 0xee11, 0xedd0, 0xedd1, 0xedd0, 0xee11, 0xee11, 0xee11, 0xe5d1, 0xe5d1, 0xee11, 0xee11, 0xee11, 0xee11, 0xee11, 0xee11, 0xee11, 0xee11, 0xee11, 0xee12, 0xee11, 0xee11, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee52, 0xee52, 0xee52, 0xee53, 0xee53, 0xee53, 0xee53, 0xf653, 0xee53, 0xcd0d, 0xd50c, 0xdd4d, 0xdd4d, 0xdd4c, 0xdd4c, 0xdd4d, 0xdd4d},
-  {0xdd4c, 0xd50c, 0xdd0c, 0xdd4d, 0xdd0c, 0xd50c, 0xd50c, 0xdd8e, 0xdd8e, 0xdd4d, 0xd50c, 0xd50b, 0xd50c, 0xdd4d, 0xdd8e, 0xdd8e, 0xe58e, 0xdd4e, 0xe58e, 0xe58e, 0xdd8e, 0xdd8e, 0xdd8e, 0xe58e, 0xe58e, 0xdd8e, 0xdd8e, 0xdd8d, 0xdd4d, 0xdd4e, 0xdd4e, 0xe58e, 0xdd8d, 0xe58e, 0xe58e, 0xe58d, 0xe58d, 0xe58d, 0xe54d, 0xdd4d, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xdd4e, 0xe58f, 0xe58f, 0xe58e, 0xe54e, 0xe54e, 0xe54d, 0xe54e, 0xe54e, 0xe54e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe54e, 0xe58e, 0xe58f, 0xe58f, 0xe5d0, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xe58f, 0xedcf, 0xed8f, 0xe58f, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xedd0, 0xedd1, 0xedd1, 0xe5d1, 0xe5d1, 0xee11, 0xe5d1, 0xedd1, 0xee11, 0xee11, 0xee11, 0xee11, 0xee11, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee52, 0xee52, 0xee53, 0xee53, 0xf653, 0xee53, 0xf653, 0xf653, 0xf653, 0xf653, 0xf653, 0xf654, 0xf654, 0xee54, 0xcccc, 0xd50b, 0xd50c, 0xd50c, 0xd50b, 0xd50b, 0xd50b, 0xd50c},
-  {0xd4cc, 0xcd0d, 0xd4cd, 0xd50d, 0xd50c, 0xd50c, 0xd50d, 0xd54e, 0xdd4e, 0xcd0d, 0xcccc, 0xcccc, 0xd4cc, 0xd50c, 0xd54d, 0xdd4e, 0xdd4e, 0xd50c, 0xd50c, 0xd50d, 0xd54d, 0xdd4d, 0xd54d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd0d, 0xdd4d, 0xdd4d, 0xdd0c, 0xdd0d, 0xdd0c, 0xd50c, 0xd50c, 0xd50c, 0xdd0c, 0xd50c, 0xd50c, 0xdd0c, 0xdd0c, 0xd50c, 0xcccc, 0xdd4d, 0xdd0d, 0xe54e, 0xdd0d, 0xd4cc, 0xd4cc, 0xd50d, 0xdd0d, 0xdd0d, 0xd50d, 0xd50e, 0xdd4e, 0xdd4e, 0xdd4e, 0xd50e, 0xd50e, 0xdd4e, 0xdd4f, 0xdd4f, 0xdd4f, 0xdd4f, 0xdd8f, 0xdd4f, 0xdd4f, 0xdd8f, 0xdd4f, 0xdd4e, 0xdd4f, 0xdd4f, 0xdd4f, 0xdd4f, 0xdd90, 0xdd90, 0xe590, 0xdd90, 0xdd90, 0xdd90, 0xdd90, 0xdd90, 0xdd90, 0xdd90, 0xddd1, 0xddd1, 0xe591, 0xe591, 0xe591, 0xe591, 0xe5d1, 0xe5d1, 0xddd1, 0xe5d1, 0xe5d1, 0xe611, 0xe612, 0xe612, 0xe612, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee13, 0xee13, 0xee13, 0xee53, 0xee53, 0xee53, 0xee53, 0xee13, 0xee53, 0xee53, 0xee53, 0xee53, 0xc48c, 0xcccb, 0xcccb, 0xcccb, 0xccca, 0xccca, 0xccca, 0xcccb},
-  {0xdd90, 0xee94, 0xee54, 0xee54, 0xee54, 0xee94, 0xee94, 0xee94, 0xee54, 0xee54, 0xee54, 0xee54, 0xee54, 0xee54, 0xee54, 0xee94, 0xee53, 0xee54, 0xee54, 0xee54, 0xee54, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee54, 0xee54, 0xee54, 0xee54, 0xee54, 0xee54, 0xee94, 0xee54, 0xee54, 0xee54, 0xee94, 0xee94, 0xee54, 0xee54, 0xee54, 0xee54, 0xee54, 0xee54, 0xee53, 0xee54, 0xee54, 0xee54, 0xee54, 0xee54, 0xee54, 0xee54, 0xf654, 0xf694, 0xf694, 0xee94, 0xee94, 0xee94, 0xee54, 0xee94, 0xf694, 0xee94, 0xee95, 0xf695, 0xf695, 0xf695, 0xee95, 0xf695, 0xf695, 0xf695, 0xf695, 0xe613, 0xdd0d, 0xdd0c, 0xdd4d, 0xd50c, 0xdd0c, 0xdd0c, 0xdd0c, 0xd50c, 0xd4cb, 0xd4cb, 0xd4cb, 0xdd0c, 0xdd0c, 0xdd0c, 0xdd0c, 0xdd0c, 0xd50c, 0xdd0c, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xd50d, 0xd50d, 0xd50c, 0xd50d, 0xdd4d, 0xdd0d, 0xd50c, 0xd50c, 0xd4cc, 0xd4cc, 0xd4cc, 0xd50d, 0xd54e, 0xdd4e, 0xd50d, 0xd4cc, 0xd4cc, 0xcccc, 0xd4cc, 0xd4cc, 0xccca, 0xc449, 0xc489, 0xcc89, 0xcc89},
-  {0xe5d1, 0xee94, 0xf694, 0xee94, 0xee93, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xee94, 0xee94, 0xee94, 0xee94, 0xf694, 0xf694, 0xf694, 0xf694, 0xee94, 0xee94, 0xf693, 0xf693, 0xf693, 0xee53, 0xf693, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xf695, 0xf695, 0xf695, 0xf695, 0xf694, 0xf695, 0xf695, 0xf694, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xee53, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe54d, 0xe58d, 0xe54d, 0xdd4d, 0xdd4d, 0xdd4d, 0xe58e, 0xdd4d, 0xe58d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd8e, 0xdd8e, 0xdd4e, 0xdd4d, 0xdd4d, 0xdd4e, 0xdd4d, 0xdd4e, 0xdd4d, 0xdd4e, 0xdd4d, 0xe58e, 0xe58e, 0xdd8e, 0xdd4d, 0xdd0c, 0xd50c, 0xd50c, 0xdd4d, 0xdd4e, 0xe58e, 0xe58f, 0xdd8e, 0xe58e, 0xdd4d, 0xe58e, 0xdd8d, 0xdd4c, 0xdd4b, 0xdd0b, 0xdd4b, 0xdd4c, 0xdd4b},
-  {0xe612, 0xee94, 0xee94, 0xee94, 0xee53, 0xf694, 0xf694, 0xee54, 0xee54, 0xee94, 0xee94, 0xee94, 0xee94, 0xee94, 0xee53, 0xf694, 0xee94, 0xf694, 0xf694, 0xf694, 0xf694, 0xee54, 0xee93, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee54, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xee94, 0xee94, 0xee94, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xee94, 0xf694, 0xf694, 0xee94, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xe612, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xe58e, 0xdd8e, 0xdd8e, 0xdd8e, 0xe58f, 0xe58f, 0xe58f, 0xe5cf, 0xe58f, 0xe58f, 0xe58f, 0xe5cf, 0xe5cf, 0xe58f, 0xe58f, 0xe5cf, 0xe58f, 0xe58f, 0xe5cf, 0xe5cf, 0xe58f, 0xe5cf, 0xe58f, 0xe58f, 0xe5cf, 0xe5cf, 0xe5cf, 0xe58e, 0xe58e, 0xdd8d, 0xdd8d, 0xe58e, 0xe5ce, 0xe5cf, 0xe5cf, 0xe58e, 0xe58e, 0xdd8d, 0xdd8d, 0xdd4c, 0xdd4c, 0xdd4c, 0xdd4c, 0xe58d, 0xe58d, 0xe58d},
-  {0xe5d1, 0xee94, 0xee53, 0xee53, 0xee53, 0xee53, 0xee54, 0xee94, 0xee94, 0xee54, 0xee54, 0xf694, 0xee54, 0xee94, 0xee54, 0xee54, 0xee54, 0xee94, 0xee94, 0xf694, 0xf694, 0xee94, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee54, 0xf694, 0xee54, 0xf694, 0xee94, 0xee94, 0xf694, 0xee94, 0xee94, 0xf694, 0xf694, 0xf694, 0xf694, 0xee94, 0xf694, 0xee94, 0xf694, 0xf694, 0xf694, 0xf695, 0xee94, 0xf694, 0xf694, 0xee94, 0xf694, 0xee94, 0xee94, 0xee94, 0xee94, 0xf695, 0xf695, 0xf694, 0xf694, 0xf695, 0xf695, 0xf695, 0xf694, 0xf695, 0xf695, 0xf695, 0xee95, 0xf695, 0xf694, 0xf695, 0xf694, 0xf694, 0xf695, 0xe613, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5cf, 0xe5d0, 0xe5d0, 0xdd8f, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5cf, 0xe58f, 0xe58f, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5d0, 0xe5cf, 0xe5ce, 0xe58e, 0xe58e, 0xe5ce, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5ce, 0xe5ce, 0xe5ce, 0xe58d, 0xe58d, 0xe58d, 0xe58e, 0xe58d, 0xdd8d},
-  {0xe611, 0xee94, 0xee54, 0xf654, 0xee54, 0xf694, 0xf694, 0xee94, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xee94, 0xee94, 0xee94, 0xee94, 0xee94, 0xee94, 0xee54, 0xee54, 0xee54, 0xee54, 0xf694, 0xee54, 0xee94, 0xee54, 0xf654, 0xf694, 0xf654, 0xf694, 0xf694, 0xf694, 0xee94, 0xee94, 0xee54, 0xee94, 0xf694, 0xee94, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xee94, 0xee94, 0xee94, 0xee94, 0xf695, 0xf695, 0xf694, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xe653, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5cf, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5ce, 0xddce, 0xe58e, 0xe58e, 0xe5ce, 0xe5ce, 0xe5ce, 0xe5ce},
-  {0xe611, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xf654, 0xee54, 0xee53, 0xee53, 0xee53, 0xee53, 0xee54, 0xee54, 0xee54, 0xee54, 0xee54, 0xf654, 0xf654, 0xee54, 0xee54, 0xee54, 0xee54, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee54, 0xee54, 0xee54, 0xee54, 0xee54, 0xee54, 0xee54, 0xee54, 0xee53, 0xee53, 0xf694, 0xee54, 0xee54, 0xee54, 0xee54, 0xee54, 0xee54, 0xee54, 0xee54, 0xf694, 0xf694, 0xf694, 0xee54, 0xee94, 0xee94, 0xf694, 0xf694, 0xf694, 0xf695, 0xf694, 0xf695, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xf695, 0xee53, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5cf, 0xe5cf, 0xddcf, 0xe5cf, 0xddcf, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d1, 0xe611, 0xe611, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d1, 0xe611, 0xe611, 0xe610, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf},
-  {0xe5d1, 0xee11, 0xee12, 0xee52, 0xee11, 0xee12, 0xedd2, 0xee12, 0xee12, 0xee12, 0xee12, 0xee12, 0xee13, 0xee13, 0xee12, 0xee12, 0xee12, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee12, 0xee12, 0xee13, 0xee13, 0xee53, 0xee53, 0xee13, 0xee13, 0xee13, 0xee13, 0xee13, 0xe612, 0xee12, 0xee52, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee13, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee53, 0xee54, 0xee54, 0xee53, 0xf694, 0xf694, 0xf694, 0xf654, 0xf654, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xf694, 0xf695, 0xf695, 0xf694, 0xf694, 0xf695, 0xf695, 0xf694, 0xf695, 0xe613, 0xe5d0, 0xe5d0, 0xddd0, 0xddd0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d1, 0xe5d0, 0xe5d0, 0xe5d0, 0xddd0, 0xe5d0, 0xddd0, 0xe5d0, 0xe5d0, 0xddd0, 0xe5d0, 0xe5d0, 0xddd0, 0xe5d0, 0xe5d1, 0xe5d1, 0xe611, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d1, 0xe611, 0xe5d1},
-  {0xd54e, 0xdd4e, 0xd54e, 0xdd8f, 0xdd4e, 0xdd4e, 0xd54e, 0xdd4f, 0xdd4f, 0xdd4f, 0xdd4f, 0xdd4f, 0xd54e, 0xd54f, 0xdd4f, 0xdd4f, 0xdd4f, 0xdd4f, 0xdd4f, 0xd54f, 0xd54f, 0xdd4f, 0xdd4f, 0xdd4f, 0xdd8f, 0xdd90, 0xdd4f, 0xdd4f, 0xdd4f, 0xdd4f, 0xdd4f, 0xdd4f, 0xdd90, 0xdd4f, 0xdd4f, 0xd54f, 0xd54f, 0xd54f, 0xd54f, 0xd54f, 0xdd90, 0xd550, 0xd54f, 0xd54f, 0xd50f, 0xd50f, 0xd50f, 0xd54f, 0xd54f, 0xd54e, 0xcd0e, 0xd54e, 0xd54e, 0xd54f, 0xd54f, 0xdd90, 0xddd0, 0xddd0, 0xddd0, 0xd54f, 0xdd90, 0xddd0, 0xe5d1, 0xddd0, 0xdd90, 0xdd90, 0xdd8f, 0xdd90, 0xdd90, 0xe5d0, 0xddd0, 0xdd90, 0xdd90, 0xdd90, 0xe5d0, 0xe5d1, 0xddd1, 0xd58f, 0xd54e, 0xdd4e, 0xdd4e, 0xdd4e, 0xd54e, 0xd54e, 0xd54e, 0xdd4e, 0xd54e, 0xd54d, 0xd54e, 0xd54d, 0xd54e, 0xd54e, 0xd54e, 0xd54e, 0xd54e, 0xd54e, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd90, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd90, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xd58f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd90, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f, 0xdd8f},
-  {0xdd8e, 0xe58e, 0xd54d, 0xdd4d, 0xdd4d, 0xe54d, 0xdd4c, 0xe54c, 0xdd4c, 0xe54d, 0xe54c, 0xdd0c, 0xdd4c, 0xdd4c, 0xe54d, 0xe54d, 0xe54d, 0xe54d, 0xdd4c, 0xdd4d, 0xdd4d, 0xdd4d, 0xe58d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd0c, 0xdd4d, 0xe58e, 0xdd4e, 0xd50c, 0xdd0c, 0xd4cc, 0xd4cc, 0xdd0c, 0xdd4d, 0xe54e, 0xe58e, 0xdd4d, 0xdd4d, 0xdd0d, 0xdd4d, 0xdd4d, 0xdd4c, 0xd50b, 0xd4ca, 0xd50a, 0xd50a, 0xd50a, 0xd4ca, 0xd4cb, 0xdd0d, 0xdd4d, 0xd50c, 0xdd0d, 0xdd4d, 0xdd0c, 0xdd0c, 0xdd0c, 0xd50c, 0xdd4d, 0xdd4d, 0xdd0c, 0xdd0c, 0xdd0c, 0xdd0c, 0xdd0c, 0xdd0c, 0xdd4c, 0xdd4c, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4c, 0xdd0c, 0xdd4c, 0xdd4c, 0xdd4c, 0xdd4c, 0xdd4c, 0xdd4c, 0xdd0c, 0xdd0c, 0xdd4c, 0xdd4c, 0xdd0b, 0xdd0b, 0xdd0b, 0xdd0b, 0xdd0b, 0xdd0b, 0xdd4c, 0xdd8d, 0xdd4d, 0xdd8d, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4c, 0xdd4c, 0xdd4c, 0xdd4c, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xe58e, 0xe54d, 0xdd4d, 0xdd4c, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd8e, 0xe58e},
-  {0xdd4d, 0xdd4d, 0xd54e, 0xe58e, 0xdd8e, 0xdd8e, 0xe58e, 0xe58e, 0xdd4e, 0xdd4e, 0xdd8e, 0xe58e, 0xdd8e, 0xe58e, 0xe58e, 0xdd8e, 0xe58e, 0xe58e, 0xe58e, 0xdd8e, 0xe58e, 0xe58e, 0xe58e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xe58e, 0xdd8e, 0xe58e, 0xdd8e, 0xe58f, 0xdd8e, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd8e, 0xdd8e, 0xe58f, 0xe58f, 0xdd8e, 0xe58e, 0xdd8e, 0xdd8d, 0xdd4d, 0xdd4c, 0xdd4c, 0xdd4b, 0xdd4c, 0xdd4c, 0xdd4c, 0xdd4c, 0xd54c, 0xd54d, 0xdd4e, 0xdd4e, 0xd50d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4e, 0xdd4d, 0xdd4e, 0xe58e, 0xe58e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd8d, 0xdd4d, 0xdd4c, 0xdd0b, 0xd50b, 0xdd0b, 0xdd4c, 0xdd4c, 0xdd4d, 0xdd4d, 0xdd4c, 0xdd4d, 0xdd4d, 0xdd4d, 0xd54c, 0xd54d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4c, 0xdd4c, 0xdd4c, 0xdd4c, 0xdd4c, 0xdd4d, 0xdd8d, 0xdd4d, 0xdd8d, 0xdd8e, 0xdd8d, 0xdd4d, 0xdd4d, 0xdd8d, 0xdd8d, 0xe58e, 0xdd8e, 0xdd8e, 0xdd4e, 0xdd4d, 0xdd4d},
-  {0xdd4d, 0xdd4d, 0xd54d, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe58f, 0xe5cf, 0xe58f, 0xe5cf, 0xe58f, 0xe5cf, 0xe5d0, 0xdd8f, 0xe5d0, 0xe5d0, 0xdd8f, 0xe5cf, 0xe5d0, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5d0, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5d0, 0xe5cf, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5ce, 0xe5ce, 0xe58e, 0xe58e, 0xe58d, 0xe58d, 0xdd4c, 0xdd4c, 0xe58d, 0xe58d, 0xe58d, 0xdd8d, 0xdd4d, 0xdd8e, 0xe58e, 0xdd8e, 0xdd8e, 0xdd4d, 0xdd4d, 0xdd8d, 0xdd4d, 0xdd4d, 0xdd4d, 0xe54d, 0xdd4d, 0xdd4d, 0xdd8e, 0xdd8e, 0xe58e, 0xdd8e, 0xdd8d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xd50d, 0xd50c, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xd50c, 0xdd4c, 0xdd4c, 0xdd0c, 0xdd0c, 0xdd4c, 0xdd4c, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4c, 0xdd4d, 0xd54c, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd8d, 0xdd4d, 0xdd4c, 0xdd4c, 0xdd4c, 0xdd4c, 0xdd4d, 0xdd4c, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd8d, 0xe58e, 0xdd8e, 0xdd8d, 0xdd4d},
-  {0xe58e, 0xdd4d, 0xd54d, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5cf, 0xe58f, 0xe5cf, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5cf, 0xe58e, 0xdd8e, 0xe58e, 0xe58e, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5ce, 0xe5ce, 0xe58e, 0xe58d, 0xe58d, 0xe5ce, 0xe5ce, 0xe58e, 0xe58e, 0xdd8e, 0xd50d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4c, 0xd50c, 0xd50c, 0xdd4c, 0xdd4d, 0xdd4d, 0xdd8d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd0c, 0xdd4d, 0xdd4d, 0xdd4e, 0xdd4d, 0xdd4e, 0xdd4d, 0xe58e, 0xe58e, 0xe58e, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xe58d, 0xe58e, 0xdd8e, 0xdd4d, 0xdd8d, 0xdd4d, 0xdd4d, 0xdd8d, 0xe58d, 0xdd8d, 0xdd4c, 0xdd4c, 0xdd0b, 0xdd0c, 0xdd4c, 0xdd4c, 0xdd4d, 0xdd8d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4c, 0xdd4d, 0xdd8d, 0xdd4d, 0xdd4d, 0xdd4d, 0xe58e},
-  {0xe58e, 0xe58e, 0xdd8e, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5cf, 0xe5cf, 0xe5d0, 0xe5cf, 0xe5cf, 0xe5cf, 0xddcf, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe611, 0xe611, 0xe611, 0xe5d0, 0xe5cf, 0xe5cf, 0xe5cf, 0xe5d0, 0xe5d0, 0xe611, 0xee11, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5cf, 0xe5ce, 0xddce, 0xdd8e, 0xe58e, 0xe5ce, 0xe5cf, 0xe5cf, 0xe5cf, 0xdd8e, 0xd50d, 0xdd4d, 0xd50c, 0xd4cc, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd8e, 0xe58e, 0xe58e, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd0c, 0xdd4c, 0xdd4d, 0xdd4d, 0xdd8d, 0xdd8d, 0xe58e, 0xdd8e, 0xdd8d, 0xdd8d, 0xdd4d, 0xdd4c, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4c, 0xdd4d, 0xdd4d, 0xe58d, 0xdd8d, 0xdd8e, 0xe58e, 0xdd8d, 0xdd4d, 0xdd4c, 0xdd4d, 0xdd4c, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d},
-  {0xe58e, 0xe58e, 0xdd4e, 0xe5d0, 0xe5cf, 0xe5d0, 0xe5cf, 0xe5d0, 0xe5d0, 0xe5d0, 0xddd0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d1, 0xe5d1, 0xe5d0, 0xe5d0, 0xe5d0, 0xddd0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d1, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xdd8f, 0xdd4e, 0xdd4e, 0xdd4e, 0xdd4e, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4e, 0xe58e, 0xe58e, 0xdd8e, 0xdd8e, 0xe58f, 0xe58f, 0xe58f, 0xe58e, 0xdd4e, 0xdd4e, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4e, 0xdd4d, 0xd50b, 0xdd0c, 0xdd0c, 0xdd0c, 0xdd0c, 0xdd0c, 0xdd4c, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd8d, 0xdd4d, 0xdd4d, 0xd54c, 0xd54c, 0xdd4d, 0xdd4d, 0xdd8d, 0xdd4d, 0xdd8e, 0xdd8d, 0xdd4d, 0xdd8d, 0xdd4d, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58d, 0xe58d, 0xe58d, 0xdd4d, 0xdd4c, 0xdd4d, 0xdd8d, 0xe58d, 0xe58e, 0xe58e, 0xe58e},
-  {0xdd8e, 0xdd4e, 0xd54f, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xe5d0, 0xddd0, 0xddd0, 0xe5d0, 0xe5d1, 0xddd0, 0xddd0, 0xddd0, 0xdd90, 0xdd90, 0xddd0, 0xddd0, 0xddd0, 0xdd90, 0xddd0, 0xddd0, 0xdd90, 0xddd0, 0xddd0, 0xddd0, 0xe5d1, 0xddd0, 0xddd0, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d0, 0xe5d0, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xddd1, 0xe5d0, 0xddd0, 0xddd0, 0xe5d1, 0xe5d1, 0xe5d1, 0xe5d1, 0xdd90, 0xd54e, 0xdd4e, 0xd54d, 0xd54d, 0xdd4e, 0xdd4e, 0xdd8f, 0xe58f, 0xdd8f, 0xdd8f, 0xdd8e, 0xdd4e, 0xdd4e, 0xdd4e, 0xdd8e, 0xdd4e, 0xdd4e, 0xdd4d, 0xd54d, 0xd50d, 0xd50d, 0xdd4d, 0xdd4e, 0xdd4e, 0xdd4e, 0xdd8e, 0xdd8e, 0xdd4e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4c, 0xdd4c, 0xd50c, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xe58e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd4e, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd4d, 0xdd8d, 0xdd8e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xe58e, 0xdd8e, 0xdd8e, 0xdd8e, 0xdd8e}
-} };
-
-// The cat tile texture
-/*
-Color cat_tex[64][64] = {
-  {0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x4010, 0x4010, 0x4010, 0x4010, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518},
-  {0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e},
-  {0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x4010, 0x4010, 0x4010, 0x518, 0x4010, 0x4010, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518},
-  {0x518, 0xa65e, 0x518, 0xa65e, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x4010, 0x4010, 0x4010, 0x518, 0xa65e, 0x518, 0x4010, 0x4010, 0xa65e, 0x518, 0xa65e, 0x518, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0xa65e, 0x518, 0xa65e},
-  {0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x4010, 0x4010, 0x518, 0xa65e, 0x518, 0xa65e, 0x4010, 0x4010, 0x4010, 0xa65e, 0x518, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010},
-  {0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x4010, 0x4010, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x4010, 0x4010, 0x4010},
-  {0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x4010, 0x4010, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x4010, 0x4010, 0x4010, 0x4010, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318},
-  {0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x4010, 0x4010, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318},
-  {0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x4010, 0x4010, 0x4010, 0x4010, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0x4010, 0x4010, 0x4010, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318},
-  {0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0x4010, 0x4010, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318},
-  {0x6318, 0x4010, 0x4010, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x4010, 0x4010, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318},
-  {0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x4010, 0x4010, 0x4010, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0x4010, 0x4010, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318},
-  {0x4010, 0x4010, 0xa65e, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318},
-  {0x4010, 0x4010, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0x4010, 0x4010, 0x4010, 0x4010, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318},
-  {0x4010, 0x4010, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x4010, 0x4010, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318},
-  {0x6318, 0x4010, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318},
-  {0x6318, 0x4010, 0x4010, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318},
-  {0x6318, 0x4010, 0x4010, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318},
-  {0x6318, 0x4010, 0x4010, 0x4010, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318},
-  {0x6318, 0x4010, 0x4010, 0x4010, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318},
-  {0x6318, 0x6318, 0x4010, 0x4010, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318},
-  {0x4010, 0x4010, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0x4010, 0x4010, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x4010, 0x4010, 0x518, 0xa65e, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010},
-  {0x4010, 0x4010, 0x4010, 0x4010, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0x4010, 0x4010, 0x4010, 0x4010, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010},
-  {0x518, 0x4010, 0x4010, 0x4010, 0x4010, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x4010, 0x4010, 0x4010, 0x4010, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e},
-  {0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x4010, 0x4010, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0x4010, 0x4010, 0x4010, 0x4010, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x4010, 0x4010, 0x4010, 0x4010, 0x518, 0xa65e, 0x518, 0xa65e, 0x518},
-  {0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x4010, 0x4010, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e},
-  {0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x4010, 0x4010, 0x4010, 0x4010, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518},
-  {0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0x4010, 0x4010, 0x4010, 0x4010, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e},
-  {0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0x4010, 0x4010, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0x4010, 0x4010, 0x4010, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0xa65e, 0x518, 0x4010, 0x4010, 0x4010, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518},
-  {0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x518, 0xa65e, 0x4010, 0x4010, 0x4010, 0x4010, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0x4010, 0x4010, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0xa65e},
-  {0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x4010, 0x4010, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518},
-  {0x518, 0xa65e, 0x518, 0xa65e, 0x4010, 0x4010, 0x4010, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0x4010, 0x4010, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e},
-  {0xa65e, 0x518, 0xa65e, 0x4010, 0x4010, 0x4010, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0x4010, 0x4010, 0xa65e, 0x518, 0x4010, 0x4010, 0x4010, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x4010, 0x4010, 0x4010, 0x4010, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518},
-  {0x518, 0xa65e, 0x4010, 0x4010, 0x4010, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x4010, 0x4010, 0x518, 0xa65e, 0x4010, 0x4010, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e},
-  {0xa65e, 0x518, 0x4010, 0x4010, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0x4010, 0x4010, 0xa65e, 0x518, 0xa65e, 0x4010, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x4010, 0x4010, 0x4010, 0x4010, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518},
-  {0x518, 0xa65e, 0x4010, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x4010, 0x4010, 0x518, 0xa65e, 0x518, 0xa65e, 0x4010, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x4010, 0x4010, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e},
-  {0xa65e, 0x518, 0x4010, 0x518, 0x4010, 0x4010, 0x4010, 0x4010, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0x4010, 0x4010, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x4010, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0x4010, 0x4010, 0x4010, 0x4010, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518},
-  {0x518, 0xa65e, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0x4010, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x4010, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0x4010, 0x4010, 0x4010, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e},
-  {0xa65e, 0x518, 0x4010, 0x4010, 0xa65e, 0x518, 0x4010, 0x4010, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x4010, 0x4010, 0x518, 0xa65e, 0x518, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518},
-  {0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x4010, 0x4010, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e},
-  {0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0x4010, 0x4010, 0xa65e, 0x518, 0xa65e, 0x518, 0x4010, 0x4010, 0x4010, 0x518, 0x4010, 0x4010, 0x4010, 0x518, 0xa65e, 0x4010, 0xa65e, 0x518, 0xa65e, 0x4010, 0x4010, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518},
-  {0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x4010, 0x4010, 0x518, 0xa65e, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x518, 0xa65e, 0x518, 0x4010, 0x518, 0xa65e, 0x518, 0x4010, 0x4010, 0x4010, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e},
-  {0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0xa65e, 0x518, 0x4010, 0x4010, 0x4010, 0x4010, 0xa65e, 0x518, 0x4010, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0x4010, 0x4010, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518},
-  {0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0x4010, 0x4010, 0x4010, 0x4010, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x4010, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x4010, 0x4010, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e},
-  {0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0x4010, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x4010, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0x4010, 0x4010, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518},
-  {0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0x4010, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0x4010, 0x4010, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e},
-  {0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0x4010, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x4010, 0x4010, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518},
-  {0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0x4010, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0x4010, 0x4010, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e},
-  {0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x4010, 0x4010, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518},
-  {0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0x4010, 0x4010, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e},
-  {0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x4010, 0x4010, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518},
-  {0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0x4010, 0x4010, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x4010, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e},
-  {0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x4010, 0x4010, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0x4010, 0x4010, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518},
-  {0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0x4010, 0x4010, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x4010, 0x4010, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e},
-  {0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0x4010, 0x4010, 0x4010, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0x4010, 0x4010, 0x4010, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518},
-  {0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x4010, 0x4010, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0x4010, 0x4010, 0x4010, 0x4010, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e},
-  {0x4010, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0x4010, 0x4010, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0x518, 0x4010, 0x4010, 0x4010, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0x4010, 0x4010},
-  {0x4010, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0x4010, 0x4010, 0x4010, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0x518, 0x4010, 0x4010, 0x4010, 0x4010, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0x4010, 0x4010, 0x4010},
-  {0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0x518, 0x518, 0x518, 0x518, 0x4010, 0x4010, 0x4010, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0x4010, 0x4010, 0x4010, 0x518},
-  {0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x4010, 0x4010, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x4010, 0x4010, 0x4010, 0x4010, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0xa65e, 0x518, 0xa65e},
-  {0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0x4010, 0x4010, 0x4010, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0xa65e, 0x518, 0xa65e, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x518, 0xa65e, 0x518, 0xa65e, 0x518},
-  {0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0x4010, 0x4010, 0x4010, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x518, 0x518, 0x518, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e},
-  {0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x4010, 0x4010, 0x4010, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x518, 0x518, 0x518, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518},
-  {0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0x4010, 0x4010, 0x4010, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x4010, 0x4010, 0x4010, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e, 0x518, 0xa65e}
-};
-*/
\ No newline at end of file
+};
\ No newline at end of file
@@ -33,6 +33,16 @@ struct Vec3 {
     z = _z;
   }
 
+  /* Accesses a component by index, where 0, 1 and 2 are x, y and z
+   */
+  Fixed24& operator[](uint8_t i) {
+    return (&x)[i];
+  }
+
+  const Fixed24& operator[](uint8_t i) const {
+    return (&x)[i];
+  }
+
   Vec3 operator+(Vec3 v) const {
     return Vec3(x + v.x, y + v.y, z + v.z);
   }
@@ -57,14 +67,29 @@ struct Vec3 {
   Vec3 operator-(Fixed24 s) const {
     return Vec3(x - s, y - s, z - s);
   }
+  /* Scales each component with a single call to fp_scale3, which gives the
+   * same results as multiplying them one at a time
+   */
   Vec3 operator*(Fixed24 s) const {
-    return Vec3(x * s, y * s, z * s);
+    Vec3 out = *this;
+
+    COUNT_OPS_N(OP_MUL, 3);
+    fp_scale3(&out.x.n, s.n);
+
+    return out;
   }
 
-  /* Computes the squared L2 norm of this vector
+  /* Computes the squared L2 norm of this vector. The squares are summed at
+   * full precision and rounded once
    */
   Fixed24 norm_squared() {
-    return sqr(x) + sqr(y) + sqr(z);
+    Fixed24 out;
+
+    COUNT_OPS_N(OP_SQR, 3);
+    COUNT_OPS_N(OP_ADD, 2);
+    out.n = fp_norm2(x.n, y.n, z.n);
+
+    return out;
   }
 
   /* Computes the euclidean length of this vector
@@ -75,9 +100,15 @@ struct Vec3 {
   }
 };
 
-// 3D dot product
+// 3D dot product. The products are summed at full precision and rounded once
 Fixed24 dot(Vec3 &l, Vec3 &r) {
-  return (l.x * r.x) + (l.y * r.y) + (l.z * r.z);
+  Fixed24 out;
+
+  COUNT_OPS_N(OP_MUL, 3);
+  COUNT_OPS_N(OP_ADD, 2);
+  out.n = fp_dot3(l.x.n, l.y.n, l.z.n, r.x.n, r.y.n, r.z.n);
+
+  return out;
 }
 
 // 3D cross product
@@ -0,0 +1,352 @@
+#pragma once
+
+/* Checks a finished render against a stored golden image, so optimizations
+ * can be shown not to change the output or slow anything down
+ *
+ * Verification is only compiled in when VERIFY is defined, for example with
+ *   make CXXFLAGS="-Wall -Wextra -Oz -DVERIFY"
+ * The first verified run of a build records its framebuffer and timings as
+ * the golden result. Later runs compare against it and report the number of
+ * differing pixels, the PSNR of the image, and the time taken for lighting
+ * and rendering. A run fails if the PSNR falls below VERIFY_MIN_PSNR, and is
+ * reported as slow if either phase is slower than VERIFY_TIME_TOLERANCE
+ * allows
+ *
+ * Golden results are kept per render configuration (grain and
+ * supersampling), so the preview and final builds each have their own. With
+ * supersampling only the last segment is left on screen to compare. Delete
+ * the RTG AppVars to record new golden results, and record them from an
+ * uninterrupted run so the timings are complete
+ *
+ * The image and the timings are recorded separately, since timings only
+ * mean something on the machine they were measured on. verify/run.sh runs
+ * the host build against golden images committed for a set of reference
+ * scenes, and records the timings on the first run. Host phases take only
+ * milliseconds, so there each one is repeated for VERIFY_REPEAT_TIME and
+ * the fastest run is compared. Host builds exit with status 1 if the image
+ * has regressed, or 2 if only the timings have
+ */
+
+#include <tice.h>
+#include "color.h"
+#include "appvar.h"
+#include "checkpoint.h"
+
+// Golden images hold 16-bit colors, which palette mode does not render
+#if defined(VERIFY) && defined(PALETTE)
+#error "VERIFY cannot be combined with PALETTE"
+#endif
+
+#ifdef __TICE__
+#include <sys/timers.h>
+#else
+#include <time.h>
+#endif
+
+// Lowest PSNR (in dB) accepted for a render which is not an exact match
+#define VERIFY_MIN_PSNR 40
+
+// How much slower than the golden result (in percent) each phase may be.
+// Can be raised at build time on machines whose speed varies
+#ifndef VERIFY_TIME_TOLERANCE
+#define VERIFY_TIME_TOLERANCE 10
+#endif
+
+// Timings are measured in ticks of a 32768Hz clock
+#define VERIFY_TICKS_PER_SECOND 32768
+
+// How long (in ticks) host builds repeat each phase to time it
+#define VERIFY_REPEAT_TIME (VERIFY_TICKS_PER_SECOND / 2)
+
+// Phases of the program which are timed
+enum VerifyPhase { VERIFY_LIGHTING, VERIFY_RENDER, VERIFY_PHASES };
+
+struct Verifier {
+  uint32_t start;
+  uint32_t times[VERIFY_PHASES];
+  bool slow; // Whether check found any phase slower than allowed
+
+  Verifier() {
+#ifdef __TICE__
+    // Timer 1 is left for the profiler
+    timer_Disable(2);
+    timer_Set(2, 0);
+    timer_Enable(2, TIMER_32K, TIMER_NOINT, TIMER_UP);
+#endif
+    slow = false;
+    start = now();
+  }
+
+  uint32_t now() {
+#ifdef __TICE__
+    return timer_Get(2);
+#else
+    // Only count time spent running this program
+    timespec ts;
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+
+    return (uint32_t)(ts.tv_sec * VERIFY_TICKS_PER_SECOND +
+                      ((int64_t)ts.tv_nsec * VERIFY_TICKS_PER_SECOND) / 1000000000);
+#endif
+  }
+
+  /* Records the time since the last phase ended as the time of this one
+   */
+  void end_phase(uint8_t phase) {
+    uint32_t time = now();
+
+    times[phase] = time - start;
+    start = time;
+  }
+
+#ifndef __TICE__
+  /* Times a phase by running it repeatedly for VERIFY_REPEAT_TIME, and
+   * records its fastest run, which is the least disturbed by anything else
+   * running on the machine
+   */
+  void repeat_phase(uint8_t phase, void (*run)()) {
+    uint32_t total = 0;
+    times[phase] = UINT32_MAX;
+
+    while (total < VERIFY_REPEAT_TIME) {
+      uint32_t begin = now();
+      run();
+      uint32_t time = now() - begin;
+
+      if (time < times[phase]) times[phase] = time;
+      total += time;
+    }
+
+    start = now();
+  }
+#endif
+
+  /* Builds the name of the AppVar holding the given chunk of the golden
+   * image, or its timings for chunk 'T'
+   */
+  void golden_name(char* name, char chunk, uint8_t grain, uint8_t supersample) {
+    name[0] = 'R';
+    name[1] = 'T';
+    name[2] = 'G';
+    name[3] = '0' + grain;
+    name[4] = '0' + supersample;
+    name[5] = chunk;
+    name[6] = '\0';
+  }
+
+  /* Stores the framebuffer as the golden image
+   */
+  void record_image(volatile Color* framebuffer, uint8_t grain, uint8_t supersample) {
+    char name[7];
+
+    for (int24_t y = 0; y < LCD_HEIGHT; y += CHECKPOINT_ROWS) {
+      int24_t rows = LCD_HEIGHT - y;
+      if (rows > CHECKPOINT_ROWS) rows = CHECKPOINT_ROWS;
+
+      golden_name(name, '0' + y / CHECKPOINT_ROWS, grain, supersample);
+
+      var_t var = open_var(name, "w");
+      if (!var) return;
+
+      write_var(var, (const Color*)framebuffer + (LCD_WIDTH * y),
+                rows * LCD_WIDTH * sizeof(Color));
+
+      archive_var(var);
+      close_var(var);
+    }
+  }
+
+  /* Stores the timings as the golden timings
+   */
+  void record_times(uint8_t grain, uint8_t supersample) {
+    char name[7];
+    golden_name(name, 'T', grain, supersample);
+
+    var_t var = open_var(name, "w");
+    if (!var) return;
+
+    write_var(var, times, sizeof(times));
+
+    archive_var(var);
+    close_var(var);
+  }
+
+  /* Compares the framebuffer against the golden image, printing the number
+   * of differing pixels and the PSNR. If there is no golden image yet, this
+   * one is recorded instead. Returns false if the image has regressed
+   */
+  bool check_image(volatile Color* framebuffer, uint8_t grain, uint8_t supersample) {
+    char name[7];
+    golden_name(name, '0', grain, supersample);
+
+    var_t var = open_var(name, "r");
+
+    if (!var) {
+      record_image(framebuffer, grain, supersample);
+
+      os_PutStrFull("Recorded golden image");
+      os_NewLine();
+      return true;
+    }
+
+    close_var(var);
+
+    uint32_t differing = 0;
+    uint32_t error = 0;
+
+    for (int24_t y = 0; y < LCD_HEIGHT; y += CHECKPOINT_ROWS) {
+      int24_t rows = LCD_HEIGHT - y;
+      if (rows > CHECKPOINT_ROWS) rows = CHECKPOINT_ROWS;
+
+      golden_name(name, '0' + y / CHECKPOINT_ROWS, grain, supersample);
+
+      var = open_var(name, "r");
+      size_t size = var ? var_size(var) : 0;
+      const Color* golden = var ? (const Color*)var_data(var) : nullptr;
+
+      if (!golden || size != rows * LCD_WIDTH * sizeof(Color)) {
+        if (var) close_var(var);
+
+        os_PutStrFull("Golden image missing");
+        os_NewLine();
+        return false;
+      }
+
+      const Color* pixels = (const Color*)framebuffer + (LCD_WIDTH * y);
+
+      for (int24_t i = 0; i < rows * LCD_WIDTH; i++) {
+        if (golden[i] == pixels[i]) continue;
+
+        differing++;
+        error += color_error(golden[i], pixels[i]);
+      }
+
+      close_var(var);
+    }
+
+    os_PutStrFull("Differing pixels: ");
+    print_decimal(differing);
+    os_NewLine();
+
+    if (!differing) return true;
+
+    // Channels are 5 bits, so the peak signal is 31
+    float mse = error / (float)(LCD_WIDTH * LCD_HEIGHT * 3);
+    float psnr = 10 * log10(31 * 31 / mse);
+
+    os_PutStrFull("PSNR: ");
+    print_decimal((uint32_t)psnr);
+    os_PutStrFull("dB");
+    os_NewLine();
+
+    return psnr >= VERIFY_MIN_PSNR;
+  }
+
+  /* Compares the timings against the golden timings, printing both. If
+   * there are no golden timings yet, these are recorded instead. Returns
+   * false if any phase has slowed down
+   */
+  bool check_times(uint8_t grain, uint8_t supersample) {
+    char name[7];
+    golden_name(name, 'T', grain, supersample);
+
+    uint32_t golden_times[VERIFY_PHASES];
+
+    var_t var = open_var(name, "r");
+    bool found = var && read_var(var, golden_times, sizeof(golden_times));
+    if (var) close_var(var);
+
+    if (!found) {
+      record_times(grain, supersample);
+
+      os_PutStrFull("Recorded golden timings");
+      os_NewLine();
+      print_times(golden_times, false);
+      return true;
+    }
+
+    print_times(golden_times, true);
+
+    bool pass = true;
+
+    for (uint8_t phase = 0; phase < VERIFY_PHASES; phase++) {
+      uint32_t limit = golden_times[phase] + golden_times[phase] * VERIFY_TIME_TOLERANCE / 100;
+
+      if (times[phase] > limit) {
+        pass = false;
+      }
+    }
+
+    return pass;
+  }
+
+  /* Compares the framebuffer and timings against the golden result, printing
+   * a report. Returns false if the image has regressed, and sets slow if any
+   * phase has
+   */
+  bool check(volatile Color* framebuffer, uint8_t grain, uint8_t supersample) {
+    os_ClrHome();
+
+    bool pass = check_image(framebuffer, grain, supersample);
+    slow = !check_times(grain, supersample);
+
+    os_PutStrFull(!pass ? "FAIL" : slow ? "SLOW" : "PASS");
+    os_NewLine();
+
+    return pass;
+  }
+
+  /* Returns the squared error summed over the channels of two colors
+   */
+  uint24_t color_error(Color c1, Color c2) {
+    const uint8_t shifts[3] = { 11, 6, 0 };
+    uint24_t error = 0;
+
+    for (uint8_t i = 0; i < 3; i++) {
+      int24_t d = ((c1 >> shifts[i]) & COLOR_MASK) - ((c2 >> shifts[i]) & COLOR_MASK);
+      error += d * d;
+    }
+
+    return error;
+  }
+
+  /* Prints the time of each phase in milliseconds, alongside the golden
+   * times if there are any
+   */
+  void print_times(uint32_t* golden_times, bool compare) {
+    const char* names[VERIFY_PHASES] = { "Lighting: ", "Render: " };
+
+    for (uint8_t phase = 0; phase < VERIFY_PHASES; phase++) {
+      os_PutStrFull(names[phase]);
+      print_decimal(milliseconds(times[phase]));
+
+      if (compare) {
+        os_PutStrFull("/");
+        print_decimal(milliseconds(golden_times[phase]));
+      }
+
+      os_PutStrFull("ms");
+      os_NewLine();
+    }
+  }
+
+  /* Converts ticks to milliseconds, without overflowing for long renders
+   */
+  uint32_t milliseconds(uint32_t ticks) {
+    return (ticks / VERIFY_TICKS_PER_SECOND) * 1000 +
+           (ticks % VERIFY_TICKS_PER_SECOND) * 1000 / VERIFY_TICKS_PER_SECOND;
+  }
+
+  void print_decimal(uint32_t n) {
+    char str[11];
+    uint8_t i = sizeof(str) - 1;
+    str[i] = '\0';
+
+    do {
+      str[--i] = '0' + n % 10;
+      n /= 10;
+    } while (n);
+
+    os_PutStrFull(&str[i]);
+  }
+};
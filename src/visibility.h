@@ -0,0 +1,91 @@
+#pragma once
+
+/* Caches which lights reach each texel of the plane lightmaps, so plane
+ * shading only needs to trace shadow rays near the edges of shadows
+ *
+ * Each light is tested from a grid of points across every texel, including
+ * its edges. Texels where every point agrees are marked as fully lit or
+ * fully shadowed by that light, and the rest are marked as boundaries, where
+ * shading traces a shadow ray as before. Shadows are cast by spheres, which
+ * are large compared to the spacing of the grid, so in practice a shadow
+ * edge cannot cross a texel without passing between two of its points
+ *
+ * The cache depends on the positions of the lights and spheres, so it must
+ * be recomputed whenever either moves
+ */
+
+#include <tice.h>
+#include "scene.h"
+#include "lightmap.h"
+
+// Intervals along each side of a texel between visibility tests
+#define VIS_STEPS 4
+
+struct Visibility {
+  // Bit l is set where light l reaches the whole texel
+  uint8_t lit[MAX_PLANES][MAP_SIZE][MAP_SIZE];
+
+  // Bit l is set where the edge of a shadow from light l may cross the texel
+  uint8_t boundary[MAX_PLANES][MAP_SIZE][MAP_SIZE];
+
+  /* Tests the visibility of every light across each texel of a plane
+   */
+  void compute(uint8_t index) {
+    const Fixed24 spacing(2.0f / (MAP_SIZE * VIS_STEPS));
+
+    uint8_t u_axis = planes.u_axis[index];
+    uint8_t v_axis = planes.v_axis[index];
+
+    for (uint8_t y = 0; y < MAP_SIZE; y++) {
+      for (uint8_t x = 0; x < MAP_SIZE; x++) {
+        uint8_t seen = 0;
+        uint8_t hidden = 0;
+
+        for (uint8_t sy = 0; sy <= VIS_STEPS; sy++) {
+          for (uint8_t sx = 0; sx <= VIS_STEPS; sx++) {
+            Vec3 pos = planes.point[index];
+
+            pos[u_axis] += spacing * Fixed24((int24_t)(x * VIS_STEPS + sx));
+            pos[v_axis] += spacing * Fixed24((int24_t)(y * VIS_STEPS + sy));
+
+            for (uint8_t l = 0; l < lights.count; l++) {
+              Ray shadow_ray(pos, lights.point[l] - pos);
+
+              if (compute_shadow(shadow_ray)) {
+                hidden |= 1 << l;
+              }
+              else {
+                seen |= 1 << l;
+              }
+            }
+          }
+        }
+
+        lit[index][x][y] = seen & ~hidden;
+        boundary[index][x][y] = seen & hidden;
+      }
+    }
+  }
+
+  /* Recomputes the cache for every plane in the scene
+   */
+  void compute_all() {
+    for (uint8_t i = 0; i < planes.count; i++) {
+      compute(i);
+    }
+  }
+
+  /* Returns the texel index along one axis of a plane lightmap for a texture
+   * coordinate, measured from the plane origin
+   */
+  static uint8_t texel(Fixed24 u) {
+    int24_t t = u.floor(MAP_BITS - 1);
+
+    if (t < 0) return 0;
+    if (t > MAP_MASK) return MAP_MASK;
+
+    return t;
+  }
+};
+
+Visibility visibility;
@@ -0,0 +1,86 @@
+#!/bin/sh
+# Builds the renderer for this machine with -DVERIFY in each reference
+# configuration, and checks its render of every scene in scenes/ against the
+# golden images in verify/golden/<scene>. See src/verify.h
+#
+# Usage: verify/run.sh
+#
+# Renders run in $VERIFY_WORK (by default a directory under /tmp), which
+# keeps the timings recorded by the first run on this machine. A missing
+# golden image is recorded there instead of checked, so to update the images
+# after an intended change, delete them from verify/golden/<scene>, run this
+# again and copy the new RTG files other than the timings (RTG..T) back.
+# A render which is only slower than recorded is measured up to
+# $VERIFY_TRIES (3 by default) times before it fails, since a busy machine
+# can slow down any single run. On machines whose speed varies more than
+# that covers, $VERIFY_TOLERANCE raises the percentage slowdown allowed (10
+# by default).
+# Exits with a non-zero status if any check fails
+
+ROOT=$(cd "$(dirname "$0")/.." && pwd)
+WORK=${VERIFY_WORK:-${TMPDIR:-/tmp}/raytrace-verify}
+CXX=${CXX:-g++}
+TRIES=${VERIFY_TRIES:-3}
+TOLERANCE=${VERIFY_TOLERANCE:-10}
+
+# Name and build flags of each reference configuration
+CONFIGS="final: supersample:-DSUPERSAMPLE=2 preview:-DPREVIEW"
+
+mkdir -p "$WORK" || exit 1
+echo "Working in $WORK"
+
+failed=0
+
+for config in $CONFIGS; do
+  name=${config%%:*}
+  flags=${config#*:}
+
+  echo "Building $name"
+  "$CXX" -std=c++17 -O2 -Wall -Wextra -I"$ROOT/host" -I"$ROOT/src" -DVERIFY \
+    -DVERIFY_TIME_TOLERANCE="$TOLERANCE" $flags \
+    "$ROOT/src/main.cpp" -o "$WORK/raytrace-$name" || exit 1
+done
+
+for path in "$ROOT"/scenes/*.json; do
+  scene=$(basename "$path" .json)
+  dir="$WORK/$scene"
+
+  mkdir -p "$dir" || exit 1
+
+  python3 "$ROOT/src/convertScene.py" "$path" "$dir/RTSCENE" || exit 1
+  cp "$ROOT"/bin/RTTEX*.8xv "$dir/" || exit 1
+
+  # Check against the committed images only, keeping the recorded timings
+  rm -f "$dir"/RTG??[0-7]
+  cp "$ROOT"/verify/golden/"$scene"/RTG* "$dir/" 2>/dev/null
+
+  for config in $CONFIGS; do
+    name=${config%%:*}
+    try=1
+
+    while :; do
+      # Light from scratch each time, so the timings are comparable
+      rm -f "$dir"/RTLIGHT "$dir"/RTSTATE "$dir"/RTFB*
+
+      echo "== $scene, $name"
+
+      (cd "$dir" && "$WORK/raytrace-$name")
+      status=$?
+
+      # Status 2 means only the timings regressed
+      [ $status -eq 2 ] && [ $try -lt "$TRIES" ] || break
+      try=$((try + 1))
+    done
+
+    if [ $status -ne 0 ]; then
+      failed=1
+    fi
+  done
+done
+
+if [ $failed -ne 0 ]; then
+  echo "Verification FAILED"
+  exit 1
+fi
+
+echo "Verification passed"